@@ -0,0 +1,239 @@
+#ifndef ARENA_H
+#define ARENA_H
+
+// Arena monotonica para a memoria de uma busca.
+//
+// Os blocos sao pedidos ao sistema em tamanhos crescentes e a memoria e
+// entregue avancando um ponteiro; liberar um pedaco pequeno nao faz nada, e
+// tudo e devolvido de uma vez quando a arena e destruida (no fim da busca).
+// Assim, os pedacos das filas e os vetores pequenos de uma busca nao geram
+// uma chamada a malloc/free cada nem fragmentam o heap de processos longos.
+//
+// Pedidos a partir de GRANDE (os vetores de nos e as tabelas depois de
+// crescerem algumas vezes) ganham uma alocacao propria, encadeada na arena:
+// ela e devolvida assim que o vetor cresce de novo, o que evita guardar
+// todas as capacidades antigas, e as restantes saem junto com a arena.
+//
+// reiniciar() devolve a arena ao estado inicial mas guarda os blocos, que sao
+// reaproveitados na ordem em que foram pedidos (SolverWorkspace reinicia a
+// mesma arena a cada busca, sem voltar ao sistema).
+//
+// Cada thread tem uma arena "atual" (EscopoArena). AlocadorArena guarda a
+// arena atual no momento em que e construido; sem arena, usa new/delete.
+// A arena nao e sincronizada: um conteiner ligado a ela so pode crescer na
+// thread que a criou.
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <memory>
+#include <type_traits>
+
+class Arena {
+public:
+    static const size_t PRIMEIRO_BLOCO = 64 * 1024;
+    static const size_t MAIOR_BLOCO = 4 * 1024 * 1024;
+    static const size_t GRANDE = 256 * 1024;
+
+    Arena() : ultimo(nullptr), reserva(nullptr), grandes(nullptr), livre(nullptr), fim(nullptr), proximoBloco(PRIMEIRO_BLOCO),
+              alocacoes(0), bytesPedidos(0), bytesReservados(0), picoReservado(0), blocos(0) {}
+    ~Arena() { liberarTudo(); }
+
+    void* alocar(size_t bytes, size_t alinhamento) {
+        alocacoes++;
+        bytesPedidos += (long long)bytes;
+        if (bytes >= GRANDE) return alocarGrande(bytes);
+        char* p = alinhar(livre, alinhamento);
+        if (!livre || p + bytes > fim) {
+            novoBloco(bytes + alinhamento);
+            p = alinhar(livre, alinhamento);
+        }
+        livre = p + bytes;
+        return p;
+    }
+
+    // So tem efeito para pedidos a partir de GRANDE
+    void liberar(void* p, size_t bytes) {
+        if (bytes < GRANDE) return;
+        Grande* g = static_cast<Grande*>(p) - 1;
+        if (g->anterior) g->anterior->proximo = g->proximo;
+        else grandes = g->proximo;
+        if (g->proximo) g->proximo->anterior = g->anterior;
+        bytesReservados -= (long long)(g->tamanho + sizeof(Grande));
+        ::operator delete(g);
+    }
+
+    void liberarTudo() {
+        reiniciar();
+        while (reserva) {
+            Bloco* proximo = reserva->anterior;
+            ::operator delete(reserva);
+            reserva = proximo;
+        }
+        proximoBloco = PRIMEIRO_BLOCO;
+        bytesReservados = 0;
+        picoReservado = 0;
+    }
+
+    // Esquece tudo o que foi entregue, mas guarda os blocos para os proximos
+    // pedidos; as estatisticas recomecam (os blocos guardados contam no pico)
+    void reiniciar() {
+        while (ultimo) {
+            Bloco* anterior = ultimo->anterior;
+            ultimo->anterior = reserva;
+            reserva = ultimo;
+            ultimo = anterior;
+        }
+        while (grandes) {
+            Grande* proximo = grandes->proximo;
+            bytesReservados -= (long long)(grandes->tamanho + sizeof(Grande));
+            ::operator delete(grandes);
+            grandes = proximo;
+        }
+        livre = fim = nullptr;
+        alocacoes = 0;
+        bytesPedidos = 0;
+        picoReservado = bytesReservados;
+        blocos = 0;
+    }
+
+    long long numAlocacoes() const { return alocacoes; }
+    long long numBytesPedidos() const { return bytesPedidos; }
+    long long picoBytesReservados() const { return picoReservado; }
+    long long bytesReservadosAgora() const { return bytesReservados; }
+    int numBlocos() const { return blocos; }  // blocos pedidos ao sistema
+
+    static Arena* atual() { return atualRef(); }
+
+private:
+    friend class EscopoArena;
+
+    struct Bloco {
+        Bloco* anterior;
+        size_t tamanho;
+    };
+
+    // Cabecalho de 32 bytes: mantem o alinhamento de qualquer tipo do solucionador
+    struct Grande {
+        Grande* anterior;
+        Grande* proximo;
+        size_t tamanho;
+        size_t reservado;
+    };
+
+    Arena(const Arena&);
+    Arena& operator=(const Arena&);
+
+    static Arena*& atualRef() {
+        static thread_local Arena* arena = nullptr;
+        return arena;
+    }
+
+    static char* alinhar(char* p, size_t alinhamento) {
+        uintptr_t x = (uintptr_t)p;
+        return (char*)((x + alinhamento - 1) & ~(uintptr_t)(alinhamento - 1));
+    }
+
+    // Blocos dobram de tamanho ate MAIOR_BLOCO; um bloco guardado por
+    // reiniciar() e usado antes, se couber (os pequenos demais sao devolvidos)
+    void novoBloco(size_t minimo) {
+        while (reserva) {
+            Bloco* b = reserva;
+            reserva = b->anterior;
+            if (b->tamanho >= minimo + sizeof(Bloco)) {
+                usarBloco(b);
+                return;
+            }
+            bytesReservados -= (long long)b->tamanho;
+            ::operator delete(b);
+        }
+        size_t tamanho = proximoBloco;
+        while (tamanho < minimo + sizeof(Bloco)) tamanho *= 2;
+        if (proximoBloco < MAIOR_BLOCO) proximoBloco *= 2;
+        Bloco* b = static_cast<Bloco*>(::operator new(tamanho));
+        b->tamanho = tamanho;
+        reservar(tamanho);
+        blocos++;
+        usarBloco(b);
+    }
+
+    void usarBloco(Bloco* b) {
+        b->anterior = ultimo;
+        ultimo = b;
+        livre = reinterpret_cast<char*>(b + 1);
+        fim = reinterpret_cast<char*>(b) + b->tamanho;
+    }
+
+    void* alocarGrande(size_t bytes) {
+        Grande* g = static_cast<Grande*>(::operator new(bytes + sizeof(Grande)));
+        g->anterior = nullptr;
+        g->proximo = grandes;
+        g->tamanho = bytes;
+        if (grandes) grandes->anterior = g;
+        grandes = g;
+        reservar(bytes + sizeof(Grande));
+        return g + 1;
+    }
+
+    void reservar(size_t bytes) {
+        bytesReservados += (long long)bytes;
+        if (bytesReservados > picoReservado) picoReservado = bytesReservados;
+    }
+
+    Bloco* ultimo;
+    Bloco* reserva;   // blocos guardados por reiniciar(), o mais antigo primeiro
+    Grande* grandes;
+    char* livre;
+    char* fim;
+    size_t proximoBloco;
+    long long alocacoes;
+    long long bytesPedidos;
+    long long bytesReservados;  // blocos (inclusive os guardados) + alocacoes grandes vivas
+    long long picoReservado;
+    int blocos;
+};
+
+// Torna 'arena' (pode ser nula) a arena atual da thread ate o fim do escopo
+class EscopoArena {
+public:
+    explicit EscopoArena(Arena* arena) : anterior(Arena::atualRef()) { Arena::atualRef() = arena; }
+    ~EscopoArena() { Arena::atualRef() = anterior; }
+
+private:
+    EscopoArena(const EscopoArena&);
+    EscopoArena& operator=(const EscopoArena&);
+
+    Arena* anterior;
+};
+
+template <class T>
+class AlocadorArena {
+public:
+    typedef T value_type;
+    typedef std::true_type propagate_on_container_copy_assignment;
+    typedef std::true_type propagate_on_container_move_assignment;
+    typedef std::true_type propagate_on_container_swap;
+
+    AlocadorArena() : arena(Arena::atual()) {}
+    template <class U>
+    AlocadorArena(const AlocadorArena<U>& outro) : arena(outro.arena) {}
+
+    T* allocate(size_t n) {
+        if (!arena) return static_cast<T*>(::operator new(n * sizeof(T)));
+        return static_cast<T*>(arena->alocar(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T* p, size_t n) {
+        if (!arena) ::operator delete(p);
+        else arena->liberar(p, n * sizeof(T));
+    }
+
+    template <class U>
+    bool operator==(const AlocadorArena<U>& outro) const { return arena == outro.arena; }
+    template <class U>
+    bool operator!=(const AlocadorArena<U>& outro) const { return arena != outro.arena; }
+
+    Arena* arena;
+};
+
+#endif
@@ -0,0 +1,1577 @@
+#ifndef AUTOMATO_PODA_H
+#define AUTOMATO_PODA_H
+
+// Gerado por gerar_automato (make automato). Nao editar.
+//
+// Automato que reconhece as 874 sequencias redundantes minimas de ate 10
+// movimentos. Operadores (destino do vazio): 0 = v - 1, 1 = v + 1, 2 = v - 2,
+// 3 = v + 2. Uma transicao -1 poda o movimento. Exemplos:
+//   deslizar esq, deslizar dir
+//   deslizar dir, deslizar esq
+//   pular esq, pular dir
+//   pular dir, pular esq
+
+namespace AutomatoPoda {
+
+const int PROFUNDIDADE = 10;
+const int NUM_ESTADOS = 1541;
+const int INICIAL = 0;
+const int PODADO = -1;
+
+const short TRANSICOES[NUM_ESTADOS][4] = {
+    { 1, 2, 3, 4 },
+    { 5, -1, 3, 4 },
+    { -1, 6, 7, 8 },
+    { 9, 10, 11, -1 },
+    { 12, 13, -1, 14 },
+    { 15, -1, 16, 17 },
+    { -1, 18, 19, 20 },
+    { 21, -1, 22, -1 },
+    { 23, 24, -1, 25 },
+    { 26, -1, 27, 28 },
+    { -1, -1, 29, 30 },
+    { 31, 32, 33, -1 },
+    { -1, -1, 34, 35 },
+    { -1, 36, 37, 38 },
+    { 39, 40, -1, 41 },
+    { 42, -1, 43, 44 },
+    { 45, 46, 47, -1 },
+    { -1, 48, -1, 49 },
+    { -1, 50, 51, 52 },
+    { 53, -1, 54, -1 },
+    { 55, 56, -1, 57 },
+    { 58, -1, 59, 60 },
+    { 61, 62, 63, -1 },
+    { -1, -1, 64, 65 },
+    { -1, 66, 67, 68 },
+    { 69, 70, -1, 71 },
+    { 72, -1, 73, 74 },
+    { 75, 76, 77, -1 },
+    { 78, 79, -1, 80 },
+    { 81, -1, 82, -1 },
+    { 83, 84, -1, 85 },
+    { 86, -1, 87, 88 },
+    { -1, -1, 89, 90 },
+    { 91, 92, 93, -1 },
+    { 94, 95, 96, -1 },
+    { 97, 98, -1, 99 },
+    { -1, 100, 101, 102 },
+    { 103, -1, 104, -1 },
+    { 105, 106, -1, 107 },
+    { -1, -1, 108, 109 },
+    { -1, 110, 111, 112 },
+    { 113, 114, -1, 71 },
+    { 115, -1, 116, 117 },
+    { 118, 119, 120, -1 },
+    { -1, 121, -1, 122 },
+    { 123, -1, 124, 125 },
+    { -1, -1, 126, 127 },
+    { 128, 129, 33, -1 },
+    { -1, 130, 131, 132 },
+    { 133, 134, -1, 135 },
+    { -1, 136, 137, 138 },
+    { 139, -1, 140, -1 },
+    { 141, 142, -1, 57 },
+    { 143, -1, 144, 145 },
+    { 146, 147, 63, -1 },
+    { -1, -1, 148, 149 },
+    { -1, 150, 151, 68 },
+    { 152, 153, -1, 71 },
+    { 154, -1, 155, 156 },
+    { 157, 158, 159, -1 },
+    { -1, 160, -1, 161 },
+    { 162, -1, 163, 164 },
+    { -1, -1, 165, 166 },
+    { 167, 168, 169, -1 },
+    { 170, 171, 96, -1 },
+    { 172, 173, -1, 174 },
+    { -1, 175, 176, 102 },
+    { 177, -1, 178, -1 },
+    { 179, 180, -1, 107 },
+    { -1, -1, 181, 182 },
+    { -1, 183, 184, 112 },
+    { 185, 114, -1, 71 },
+    { 186, -1, 187, 188 },
+    { 189, 190, 191, -1 },
+    { -1, 192, -1, 193 },
+    { 194, -1, 195, 196 },
+    { -1, -1, 197, 198 },
+    { 199, 200, 33, -1 },
+    { -1, -1, 201, 202 },
+    { -1, 203, 204, 205 },
+    { 206, 207, -1, 208 },
+    { 58, -1, 59, 209 },
+    { 61, 210, 63, -1 },
+    { -1, -1, 211, 212 },
+    { -1, 213, 214, 215 },
+    { 216, 217, -1, 218 },
+    { 219, -1, 73, 220 },
+    { 221, 222, 77, -1 },
+    { 223, 224, -1, 225 },
+    { 226, -1, 227, -1 },
+    { 228, 229, -1, 230 },
+    { 231, -1, 87, 232 },
+    { -1, -1, 89, 233 },
+    { 91, 234, 93, -1 },
+    { 235, -1, 236, 237 },
+    { -1, -1, 29, 238 },
+    { 239, 240, 241, -1 },
+    { -1, -1, 242, 35 },
+    { -1, 243, 244, 245 },
+    { 246, 247, -1, 248 },
+    { -1, 249, 250, 138 },
+    { 251, -1, 252, -1 },
+    { 253, 254, -1, 255 },
+    { 256, -1, 257, 258 },
+    { 259, 260, 261, -1 },
+    { -1, -1, 262, 263 },
+    { -1, 264, 265, 266 },
+    { 267, 268, -1, 71 },
+    { 269, 270, 271, -1 },
+    { 272, 273, -1, 174 },
+    { -1, 175, 274, 102 },
+    { 275, -1, 276, -1 },
+    { 277, 180, -1, 107 },
+    { -1, -1, 278, 182 },
+    { -1, 183, 279, 112 },
+    { 280, -1, 116, 281 },
+    { 118, 282, 120, -1 },
+    { -1, 283, -1, 284 },
+    { 123, -1, 124, 285 },
+    { -1, -1, 126, 286 },
+    { 128, 287, 33, -1 },
+    { -1, 288, 289, 290 },
+    { 291, 134, -1, 135 },
+    { 72, -1, 73, 292 },
+    { 75, 293, 77, -1 },
+    { 294, 295, -1, 296 },
+    { 297, -1, 82, -1 },
+    { 298, 299, -1, 85 },
+    { 86, -1, 87, 300 },
+    { -1, -1, 89, 301 },
+    { -1, 302, 156, 102 },
+    { 303, -1, 304, -1 },
+    { 305, 306, -1, 307 },
+    { -1, -1, 308, 309 },
+    { -1, 310, 311, 312 },
+    { 313, 314, -1, 71 },
+    { -1, 136, 315, 138 },
+    { 316, -1, 317, -1 },
+    { 318, 142, -1, 57 },
+    { -1, -1, 144, 145 },
+    { 319, -1, 320, -1 },
+    { -1, -1, 321, 149 },
+    { -1, 150, 322, 68 },
+    { 323, -1, 324, -1 },
+    { 325, 326, 327, -1 },
+    { -1, 328, -1, 161 },
+    { 329, -1, 163, 330 },
+    { -1, -1, 165, 331 },
+    { 332, 333, 334, -1 },
+    { 335, 173, -1, 174 },
+    { -1, 175, 336, 102 },
+    { 337, -1, 338, -1 },
+    { -1, -1, 339, 182 },
+    { -1, 183, 340, 112 },
+    { 341, -1, 342, 343 },
+    { 344, 345, 191, -1 },
+    { -1, -1, -1, -1 },
+    { 346, -1, 195, 347 },
+    { -1, -1, 197, 348 },
+    { 349, 350, 33, -1 },
+    { -1, 351, 204, 352 },
+    { 353, 354, -1, 355 },
+    { 356, -1, 73, 357 },
+    { 358, 359, 77, -1 },
+    { 360, 361, -1, 362 },
+    { 363, -1, 364, -1 },
+    { 365, 366, -1, 230 },
+    { 367, -1, 87, 368 },
+    { -1, -1, 89, 369 },
+    { 91, 370, 93, -1 },
+    { 371, -1, 372, 373 },
+    { -1, -1, 374, 238 },
+    { -1, -1, 375, 35 },
+    { -1, 243, 376, 245 },
+    { 377, 247, -1, 248 },
+    { -1, 249, 378, 138 },
+    { 379, -1, 380, -1 },
+    { 381, -1, 382, 258 },
+    { 383, 260, 261, -1 },
+    { -1, -1, 384, 263 },
+    { -1, 264, 385, 266 },
+    { 386, 387, 388, -1 },
+    { 389, 273, -1, 174 },
+    { -1, 175, 390, 102 },
+    { 391, -1, 392, -1 },
+    { -1, -1, 393, 182 },
+    { 394, -1, 116, 395 },
+    { 118, 396, 120, -1 },
+    { -1, 397, -1, 398 },
+    { 123, -1, 124, 399 },
+    { -1, -1, 126, 400 },
+    { 128, 401, 33, -1 },
+    { -1, -1, 131, 402 },
+    { -1, 403, -1, 404 },
+    { 72, -1, 73, 405 },
+    { 75, 406, 77, -1 },
+    { 407, 408, -1, 409 },
+    { 410, -1, 82, -1 },
+    { 83, 411, -1, 412 },
+    { 86, -1, 87, 413 },
+    { -1, -1, 89, 414 },
+    { 94, 415, 96, -1 },
+    { 416, 417, -1, 418 },
+    { -1, 419, 156, 420 },
+    { -1, -1, 304, -1 },
+    { 421, 422, -1, 423 },
+    { -1, -1, 424, 425 },
+    { -1, 426, 427, 428 },
+    { 429, 430, -1, 431 },
+    { -1, 432, -1, 433 },
+    { -1, -1, 165, 434 },
+    { 435, -1, 436, -1 },
+    { 437, 173, -1, 174 },
+    { -1, 438, 439, 102 },
+    { 440, -1, 441, -1 },
+    { 442, 443, -1, 444 },
+    { -1, -1, 445, 446 },
+    { -1, 447, 448, 449 },
+    { 450, 451, -1, 71 },
+    { 186, -1, 187, 452 },
+    { -1, 192, -1, 453 },
+    { 194, -1, 195, 454 },
+    { -1, -1, 197, 455 },
+    { -1, -1, 201, 456 },
+    { -1, 457, 204, 458 },
+    { 459, 460, -1, 461 },
+    { 58, -1, 59, 462 },
+    { 61, 463, 63, -1 },
+    { -1, -1, 211, 464 },
+    { -1, 465, 466, 467 },
+    { 468, 469, -1, 470 },
+    { 219, -1, 73, 471 },
+    { 472, 473, -1, 474 },
+    { 475, 476, -1, 477 },
+    { -1, -1, 89, 478 },
+    { 479, -1, 480, 481 },
+    { 482, 483, 484, -1 },
+    { 485, 486, -1, 487 },
+    { -1, 488, -1, 489 },
+    { 490, -1, 491, 492 },
+    { -1, -1, 493, 494 },
+    { 495, 496, 93, -1 },
+    { 497, 498, 499, -1 },
+    { -1, 100, 500, 102 },
+    { 501, -1, 502, -1 },
+    { 503, 504, -1, 107 },
+    { -1, -1, 505, 506 },
+    { -1, 507, 508, 112 },
+    { 509, 114, -1, 71 },
+    { -1, 510, 511, 138 },
+    { 512, -1, 513, -1 },
+    { -1, -1, 514, 145 },
+    { 515, -1, 516, -1 },
+    { -1, -1, 517, 149 },
+    { -1, 150, 518, 68 },
+    { 519, 153, -1, 71 },
+    { 520, -1, 521, 156 },
+    { 522, 523, 524, -1 },
+    { -1, -1, -1, 161 },
+    { 525, -1, 526, 527 },
+    { -1, -1, 165, 528 },
+    { 529, 530, 531, -1 },
+    { 332, 171, 532, -1 },
+    { 533, 534, -1, 174 },
+    { -1, 175, 535, 102 },
+    { 536, -1, 537, -1 },
+    { 538, 180, -1, 107 },
+    { -1, -1, 539, 182 },
+    { -1, 183, 540, 112 },
+    { 541, -1, 542, 373 },
+    { -1, -1, 543, 238 },
+    { 544, 240, 545, -1 },
+    { -1, -1, 546, 35 },
+    { -1, 243, 547, 245 },
+    { 251, -1, 548, -1 },
+    { 381, -1, 549, 258 },
+    { 550, 551, 552, -1 },
+    { -1, -1, 553, 263 },
+    { 554, 555, 556, -1 },
+    { 557, -1, 558, -1 },
+    { 280, -1, 116, 559 },
+    { -1, 560, -1, 561 },
+    { -1, -1, 126, 562 },
+    { -1, -1, 289, 290 },
+    { -1, 563, -1, 135 },
+    { 294, 564, -1, 565 },
+    { 298, 566, -1, 567 },
+    { -1, -1, 89, 568 },
+    { -1, 569, -1, 570 },
+    { 571, -1, 304, -1 },
+    { 572, 573, -1, 574 },
+    { -1, -1, 575, 309 },
+    { -1, 192, -1, 576 },
+    { -1, -1, 197, 577 },
+    { -1, -1, 201, 578 },
+    { -1, 457, 204, 579 },
+    { 580, 581, -1, 208 },
+    { 58, -1, 59, 582 },
+    { -1, -1, 211, 583 },
+    { -1, 584, 466, 585 },
+    { 223, 586, -1, 587 },
+    { 588, 589, -1, 590 },
+    { -1, 591, 250, 138 },
+    { 592, -1, 593, 258 },
+    { 259, 594, 261, -1 },
+    { -1, -1, 595, 263 },
+    { -1, 264, 596, 266 },
+    { 597, 268, -1, 71 },
+    { 598, 270, 271, -1 },
+    { 599, 600, -1, 174 },
+    { -1, 175, 601, 102 },
+    { 602, -1, 603, -1 },
+    { 604, 180, -1, 107 },
+    { -1, -1, 605, 182 },
+    { -1, 183, 606, 112 },
+    { 316, -1, 607, -1 },
+    { -1, -1, 608, 145 },
+    { 609, -1, 610, -1 },
+    { -1, -1, 611, 149 },
+    { 612, -1, 613, 614 },
+    { 615, 616, 169, -1 },
+    { 617, 618, 619, -1 },
+    { 620, -1, 621, -1 },
+    { 622, -1, 623, 624 },
+    { 625, 626, 191, -1 },
+    { 627, -1, 195, 628 },
+    { -1, -1, 197, -1 },
+    { 629, 630, 33, -1 },
+    { -1, 351, -1, 352 },
+    { 356, -1, 73, 631 },
+    { 360, 361, -1, 632 },
+    { -1, 366, -1, 633 },
+    { -1, -1, 372, 373 },
+    { -1, -1, 634, 238 },
+    { 635, -1, 241, -1 },
+    { -1, -1, 636, 35 },
+    { 637, -1, 638, -1 },
+    { 639, -1, 640, 258 },
+    { 641, 260, 642, -1 },
+    { 643, 387, 644, -1 },
+    { 391, -1, 645, -1 },
+    { 394, -1, 116, 646 },
+    { 118, 647, 120, -1 },
+    { -1, 648, -1, 649 },
+    { 123, -1, 124, 650 },
+    { -1, -1, 126, 651 },
+    { 72, -1, 73, 652 },
+    { 653, 654, -1, 655 },
+    { 656, -1, -1, -1 },
+    { 86, -1, 87, 657 },
+    { -1, -1, 89, 658 },
+    { -1, 659, -1, 420 },
+    { 660, 661, -1, 662 },
+    { -1, -1, 663, 664 },
+    { -1, 426, 665, 428 },
+    { 666, 430, -1, 431 },
+    { 186, -1, 187, 667 },
+    { -1, 192, -1, 156 },
+    { 194, -1, 195, 668 },
+    { -1, -1, 197, 669 },
+    { -1, -1, 201, 670 },
+    { -1, -1, 204, -1 },
+    { 671, 672, -1, 461 },
+    { 58, -1, 59, 673 },
+    { 61, 674, 63, -1 },
+    { -1, -1, 211, 675 },
+    { -1, 676, 677, 678 },
+    { 219, -1, 73, 679 },
+    { 680, 681, -1, 682 },
+    { 683, 684, -1, 685 },
+    { -1, -1, 89, 686 },
+    { 687, -1, 480, -1 },
+    { 688, 326, 689, -1 },
+    { 690, 691, -1, 487 },
+    { 692, -1, 82, -1 },
+    { 693, 498, 694, -1 },
+    { 695, -1, 696, -1 },
+    { -1, -1, 697, 506 },
+    { 512, -1, 698, -1 },
+    { -1, -1, 699, 145 },
+    { 700, -1, 701, -1 },
+    { -1, -1, 521, 156 },
+    { 702, -1, 524, -1 },
+    { 703, -1, 704, 705 },
+    { 332, 171, 706, -1 },
+    { 536, -1, 707, -1 },
+    { 708, -1, 709, 373 },
+    { -1, -1, 710, 238 },
+    { 711, 240, 545, -1 },
+    { -1, -1, 712, 35 },
+    { 251, -1, 713, -1 },
+    { 381, -1, 714, 258 },
+    { 715, 716, 717, -1 },
+    { 718, 555, 719, -1 },
+    { 280, -1, 116, 720 },
+    { -1, 283, -1, 721 },
+    { -1, -1, 126, 722 },
+    { -1, 723, 289, -1 },
+    { 724, 725, -1, 135 },
+    { 294, 726, -1, 727 },
+    { 728, 729, -1, 730 },
+    { -1, -1, 89, 731 },
+    { 732, 733, -1, 307 },
+    { -1, 734, -1, 735 },
+    { 736, 737, -1, 71 },
+    { -1, 738, -1, 739 },
+    { -1, -1, 197, 740 },
+    { -1, -1, 201, 741 },
+    { -1, 742, 204, 743 },
+    { 206, 744, -1, 745 },
+    { 58, -1, 59, 746 },
+    { -1, -1, 214, 747 },
+    { -1, 748, -1, 749 },
+    { 223, 750, -1, 751 },
+    { 752, 753, -1, 754 },
+    { -1, -1, 29, 755 },
+    { -1, -1, -1, 756 },
+    { -1, 757, 156, 735 },
+    { 758, 759, -1, 248 },
+    { -1, 760, -1, 761 },
+    { 762, 763, -1, 764 },
+    { -1, -1, 156, 765 },
+    { -1, 766, 767, 266 },
+    { 768, 268, -1, 71 },
+    { 769, 270, 271, -1 },
+    { 770, 273, -1, 174 },
+    { -1, 175, 771, 102 },
+    { 275, -1, 772, -1 },
+    { 773, 443, -1, 107 },
+    { -1, -1, 774, 775 },
+    { -1, 447, 776, 112 },
+    { 777, 114, -1, 71 },
+    { -1, 778, 204, 352 },
+    { 779, 780, -1, 781 },
+    { 365, 366, -1, 782 },
+    { 371, -1, 372, 156 },
+    { 783, 784, 241, -1 },
+    { -1, -1, 785, 35 },
+    { -1, 786, 378, 138 },
+    { 787, -1, -1, -1 },
+    { 788, -1, 382, 258 },
+    { 789, 790, 791, -1 },
+    { -1, -1, 792, 263 },
+    { -1, 264, 793, 266 },
+    { 794, 268, -1, 71 },
+    { 795, 387, 796, -1 },
+    { 797, 798, -1, 174 },
+    { -1, 175, 799, 102 },
+    { 800, -1, 801, -1 },
+    { 802, 180, -1, 107 },
+    { -1, -1, 803, 182 },
+    { -1, 183, 804, 112 },
+    { -1, 397, -1, 805 },
+    { -1, 806, -1, 807 },
+    { 407, 408, -1, 808 },
+    { 83, 411, -1, 809 },
+    { 416, 810, -1, 811 },
+    { -1, -1, 156, 420 },
+    { -1, 748, -1, 812 },
+    { -1, -1, 424, 813 },
+    { -1, 814, 815, 816 },
+    { 429, 817, -1, 431 },
+    { -1, 818, -1, 819 },
+    { -1, -1, 165, 820 },
+    { 821, 822, -1, 174 },
+    { -1, 823, 439, 824 },
+    { 825, -1, 441, -1 },
+    { 826, 827, -1, 444 },
+    { -1, -1, 445, 828 },
+    { -1, 426, 448, 829 },
+    { 450, 830, -1, 71 },
+    { -1, 192, -1, 831 },
+    { -1, -1, 201, 832 },
+    { -1, 457, 204, 809 },
+    { 833, 834, -1, 461 },
+    { -1, -1, 211, 835 },
+    { -1, 836, 466, 837 },
+    { 838, 839, -1, 470 },
+    { 475, 840, -1, 841 },
+    { 842, -1, 187, 843 },
+    { 844, 845, 191, -1 },
+    { -1, 846, -1, -1 },
+    { 847, -1, 195, 848 },
+    { -1, -1, 197, 849 },
+    { 199, 850, 33, -1 },
+    { -1, -1, 201, 851 },
+    { -1, 852, 204, 205 },
+    { 853, 854, -1, 781 },
+    { -1, 855, 156, 856 },
+    { 857, 858, -1, 218 },
+    { 219, -1, 73, 859 },
+    { 221, 860, 77, -1 },
+    { 861, 862, -1, 863 },
+    { 864, -1, 227, -1 },
+    { 865, 866, -1, 867 },
+    { 231, -1, 87, 868 },
+    { -1, -1, 89, 869 },
+    { 870, -1, 871, 872 },
+    { -1, -1, 29, -1 },
+    { 873, 784, 874, -1 },
+    { 251, -1, 875, -1 },
+    { 876, -1, 257, 258 },
+    { 877, 790, 878, -1 },
+    { -1, -1, 879, 263 },
+    { -1, 264, 880, 266 },
+    { 881, 270, 882, -1 },
+    { 883, 273, -1, 174 },
+    { -1, 175, 884, 102 },
+    { 885, -1, 886, -1 },
+    { -1, -1, 887, 182 },
+    { -1, 136, 888, 138 },
+    { 316, -1, 889, -1 },
+    { -1, -1, -1, 145 },
+    { 890, -1, 320, -1 },
+    { 891, 326, 327, -1 },
+    { 892, -1, 893, -1 },
+    { 894, 895, 896, -1 },
+    { 897, 618, 898, -1 },
+    { 620, -1, 899, -1 },
+    { -1, -1, 900, 182 },
+    { 901, -1, 902, -1 },
+    { 903, 904, 905, -1 },
+    { 906, -1, 907, 908 },
+    { -1, -1, 909, 156 },
+    { 910, 911, 33, -1 },
+    { 912, -1, 913, 914 },
+    { 915, 916, 77, -1 },
+    { 917, 361, -1, 362 },
+    { 365, 918, -1, 230 },
+    { 490, -1, 87, 919 },
+    { -1, -1, 89, 920 },
+    { 91, 921, 93, -1 },
+    { 922, -1, 923, -1 },
+    { -1, -1, 924, 35 },
+    { -1, 243, 925, 245 },
+    { 637, -1, 926, -1 },
+    { 927, -1, 382, 258 },
+    { 641, 260, 928, -1 },
+    { -1, -1, 929, 263 },
+    { 930, 931, 932, -1 },
+    { 933, -1, 934, -1 },
+    { 935, -1, 936, 481 },
+    { 937, 938, 939, -1 },
+    { 940, -1, 941, -1 },
+    { 942, -1, 943, 944 },
+    { 945, 496, 93, -1 },
+    { 693, 498, 946, -1 },
+    { 695, -1, 947, -1 },
+    { 700, -1, 928, -1 },
+    { 948, -1, 949, -1 },
+    { 950, -1, 951, 705 },
+    { -1, -1, 952, 528 },
+    { 953, 530, 531, -1 },
+    { 332, 171, 954, -1 },
+    { 708, -1, 955, 373 },
+    { -1, -1, 956, 238 },
+    { 957, 240, 545, -1 },
+    { 381, -1, 958, 258 },
+    { 959, 716, 552, -1 },
+    { -1, 560, -1, 960 },
+    { -1, -1, 289, 961 },
+    { -1, 962, -1, 135 },
+    { 298, 963, -1, 567 },
+    { -1, 964, 965, 312 },
+    { -1, 966, 204, 579 },
+    { 580, 967, -1, 968 },
+    { -1, -1, 466, 585 },
+    { -1, 217, -1, 218 },
+    { 588, 589, -1, 969 },
+    { -1, 970, 971, 138 },
+    { 972, 254, -1, 255 },
+    { 592, -1, 593, -1 },
+    { -1, -1, -1, 263 },
+    { -1, 264, 973, 266 },
+    { 974, 268, -1, 71 },
+    { 598, -1, 271, -1 },
+    { -1, 806, -1, 975 },
+    { 83, 411, -1, 976 },
+    { 416, 810, -1, 977 },
+    { -1, 422, -1, 423 },
+    { -1, -1, 424, 978 },
+    { -1, 979, 815, 980 },
+    { -1, 432, -1, 981 },
+    { 821, 173, -1, 174 },
+    { -1, 982, -1, 102 },
+    { 572, 983, -1, 444 },
+    { -1, 457, 204, 984 },
+    { 459, 985, -1, 461 },
+    { -1, -1, 211, 986 },
+    { -1, 836, 466, 987 },
+    { 468, 988, -1, 470 },
+    { -1, 510, 989, 138 },
+    { 520, -1, 521, -1 },
+    { 990, 991, 524, -1 },
+    { -1, -1, 165, 992 },
+    { -1, 171, -1, -1 },
+    { 536, -1, 993, -1 },
+    { -1, -1, 994, 182 },
+    { 995, -1, 996, 997 },
+    { -1, -1, 998, 35 },
+    { -1, 243, 999, 245 },
+    { 251, -1, 156, -1 },
+    { -1, -1, -1, 258 },
+    { 1000, 551, 552, -1 },
+    { -1, -1, 1001, 263 },
+    { 897, 1002, 556, -1 },
+    { 1003, -1, 1004, -1 },
+    { 1005, -1, 1006, -1 },
+    { 1007, -1, 327, -1 },
+    { 1008, -1, 1009, 1010 },
+    { 615, 1011, 169, -1 },
+    { 617, 618, 1012, -1 },
+    { 356, -1, 73, 156 },
+    { 358, 1013, 77, -1 },
+    { -1, 361, -1, 1014 },
+    { 367, -1, 87, 1015 },
+    { -1, -1, 89, 1016 },
+    { -1, -1, 1017, 373 },
+    { -1, -1, 1018, 238 },
+    { 1019, -1, 241, -1 },
+    { 639, -1, 1020, 258 },
+    { 1021, 260, 642, -1 },
+    { 394, -1, 116, 1022 },
+    { 118, 1023, 120, -1 },
+    { -1, -1, -1, 1024 },
+    { 123, -1, 124, 1025 },
+    { -1, -1, 126, 1026 },
+    { 72, -1, 73, 1027 },
+    { 1028, 1029, -1, -1 },
+    { 86, -1, 87, 1030 },
+    { -1, -1, 89, 1031 },
+    { -1, 846, -1, 156 },
+    { 1032, 672, -1, 461 },
+    { 1033, 469, -1, 470 },
+    { 1034, -1, 82, -1 },
+    { 1035, -1, 491, 1036 },
+    { 1037, 498, 694, -1 },
+    { -1, -1, 1038, 145 },
+    { 1039, -1, 701, -1 },
+    { -1, -1, 1040, 156 },
+    { 1041, -1, 524, -1 },
+    { -1, -1, 704, 705 },
+    { 1042, -1, 531, -1 },
+    { 1043, -1, 709, 373 },
+    { 1044, 240, 1045, -1 },
+    { 715, 716, 1046, -1 },
+    { -1, 560, -1, 156 },
+    { -1, -1, 126, 1047 },
+    { -1, -1, 289, -1 },
+    { -1, 1048, -1, 135 },
+    { 294, 681, -1, 1049 },
+    { 683, 684, -1, 1050 },
+    { -1, 1051, -1, 1052 },
+    { -1, -1, 201, 1053 },
+    { -1, 1054, 204, 1055 },
+    { 1056, -1, -1, -1 },
+    { -1, -1, 211, 1057 },
+    { 223, 750, -1, 1058 },
+    { 752, 1059, -1, 1060 },
+    { -1, 1061, -1, 761 },
+    { -1, -1, -1, 765 },
+    { -1, 766, 1062, 266 },
+    { 1063, 268, -1, 71 },
+    { 1064, -1, 271, -1 },
+    { 1065, 273, -1, 174 },
+    { 602, -1, 772, -1 },
+    { -1, -1, 1066, 775 },
+    { -1, 397, -1, 1067 },
+    { 407, 408, -1, 1068 },
+    { 83, 411, -1, 156 },
+    { 1069, -1, -1, -1 },
+    { -1, -1, 424, 1070 },
+    { -1, 1071, 1072, 980 },
+    { -1, 1073, -1, 1074 },
+    { -1, -1, 165, 1075 },
+    { -1, 1076, -1, 174 },
+    { -1, 823, -1, 824 },
+    { -1, -1, 441, -1 },
+    { 572, 573, -1, 444 },
+    { -1, 192, -1, 1077 },
+    { -1, -1, 201, 1078 },
+    { -1, 457, 204, 156 },
+    { 1079, 1080, -1, 461 },
+    { -1, -1, 211, 1081 },
+    { -1, -1, 466, -1 },
+    { 1082, 1083, -1, 470 },
+    { 475, 1084, -1, 1085 },
+    { 1086, -1, 187, 843 },
+    { 847, -1, 195, 1087 },
+    { 199, 1088, 33, -1 },
+    { -1, -1, 201, -1 },
+    { -1, 852, -1, 205 },
+    { 58, -1, 59, 1089 },
+    { -1, -1, 871, 872 },
+    { 1090, -1, 874, -1 },
+    { 1091, -1, 257, 258 },
+    { 1092, 790, 1093, -1 },
+    { 881, 270, 1094, -1 },
+    { 1095, -1, 320, -1 },
+    { 1096, 326, 327, -1 },
+    { -1, -1, 893, -1 },
+    { 1097, -1, 896, -1 },
+    { 1098, -1, 907, 927 },
+    { 912, -1, 913, -1 },
+    { 1099, 326, 77, -1 },
+    { 690, 156, -1, 362 },
+    { 1100, -1, 1101, -1 },
+    { 641, 260, 1102, -1 },
+    { -1, -1, 936, 481 },
+    { 1103, -1, 939, -1 },
+    { 1104, -1, 1105, -1 },
+    { 1106, -1, 1107, 1108 },
+    { 693, 498, 1109, -1 },
+    { 700, -1, 1102, -1 },
+    { 1110, -1, 1111, -1 },
+    { 1112, -1, 1113, 705 },
+    { -1, -1, 1114, 528 },
+    { 1115, 530, 531, -1 },
+    { 708, -1, 1116, 373 },
+    { 1117, 240, 545, -1 },
+    { -1, 560, -1, 1118 },
+    { -1, 1119, -1, 1120 },
+    { 298, 566, -1, 1121 },
+    { -1, -1, -1, 570 },
+    { -1, -1, 575, 1122 },
+    { -1, 1123, 1124, 312 },
+    { -1, 457, 204, 1125 },
+    { 580, 1126, -1, 208 },
+    { -1, -1, 211, 1127 },
+    { -1, 1128, 466, -1 },
+    { 216, 1129, -1, 218 },
+    { 588, 589, -1, 1130 },
+    { -1, -1, 156, 263 },
+    { -1, 1131, 596, 266 },
+    { -1, 1132, -1, 102 },
+    { 572, 983, -1, 107 },
+    { -1, -1, 1133, 182 },
+    { -1, 183, 1134, 112 },
+    { -1, -1, 131, 1135 },
+    { -1, 1136, -1, 404 },
+    { 83, 411, -1, 1137 },
+    { 416, 1138, -1, 418 },
+    { -1, 1139, 156, -1 },
+    { 421, 1140, -1, 423 },
+    { -1, -1, 427, 428 },
+    { -1, 1141, -1, 431 },
+    { -1, 432, -1, 1142 },
+    { 826, 443, -1, 444 },
+    { -1, 979, -1, 1143 },
+    { 1144, 451, -1, 71 },
+    { -1, 457, 204, 1145 },
+    { 459, 1146, -1, 1147 },
+    { -1, -1, 211, 1148 },
+    { -1, 1149, 466, 467 },
+    { 468, 1150, -1, 1120 },
+    { -1, 1151, -1, 489 },
+    { 1152, 98, -1, 99 },
+    { -1, 1153, -1, 102 },
+    { -1, -1, 1154, 506 },
+    { -1, 507, 1155, 112 },
+    { -1, 1156, 1054, 138 },
+    { 1157, 142, -1, 57 },
+    { -1, -1, -1, 149 },
+    { -1, 150, 1158, 68 },
+    { 1159, 153, -1, 71 },
+    { 1160, 534, -1, 174 },
+    { -1, 175, 1161, 102 },
+    { 1162, -1, 993, -1 },
+    { -1, -1, 1163, 182 },
+    { 1164, -1, 542, 1165 },
+    { -1, -1, 1166, 35 },
+    { 251, -1, -1, -1 },
+    { 1167, 551, 552, -1 },
+    { -1, -1, 1168, 263 },
+    { 1169, 555, 556, -1 },
+    { 797, 273, -1, 174 },
+    { 1170, -1, 558, -1 },
+    { -1, -1, 1171, 182 },
+    { -1, 1172, -1, 420 },
+    { -1, -1, 1173, 664 },
+    { -1, 979, 1174, 980 },
+    { 1175, 430, -1, 431 },
+    { 1176, 1177, -1, 470 },
+    { 490, -1, 491, 1178 },
+    { -1, -1, 493, 1179 },
+    { 1180, -1, 694, -1 },
+    { -1, 510, 1181, 138 },
+    { -1, -1, 1182, 145 },
+    { -1, -1, 521, -1 },
+    { 703, -1, 704, 1183 },
+    { -1, -1, 165, 1184 },
+    { 529, 1185, 531, -1 },
+    { 617, 171, -1, -1 },
+    { 536, -1, 1186, -1 },
+    { -1, -1, 1187, 182 },
+    { 1188, -1, 709, 997 },
+    { 1189, 1190, 545, -1 },
+    { -1, -1, 1191, 35 },
+    { -1, 243, 1192, 245 },
+    { 251, -1, 1193, -1 },
+    { 639, -1, -1, 258 },
+    { 1194, 716, 717, -1 },
+    { -1, -1, 1195, 263 },
+    { 1196, 1197, 719, -1 },
+    { 1198, -1, 1199, -1 },
+    { 724, 1200, -1, 135 },
+    { -1, -1, -1, 735 },
+    { -1, 1141, -1, 71 },
+    { 206, 744, -1, 1201 },
+    { -1, 1202, -1, 1120 },
+    { -1, -1, 156, 735 },
+    { -1, 1141, -1, 248 },
+    { 1203, 268, -1, 71 },
+    { 821, 1204, -1, 174 },
+    { -1, 1205, 771, 1206 },
+    { 1207, -1, 772, -1 },
+    { 1208, 443, -1, 107 },
+    { -1, 426, 776, 112 },
+    { -1, 1209, 204, 352 },
+    { 779, 1210, -1, 1211 },
+    { 365, 366, -1, 1212 },
+    { -1, -1, -1, 35 },
+    { -1, 1213, 1214, 1215 },
+    { -1, 1216, -1, 138 },
+    { 762, 1217, -1, 255 },
+    { 788, -1, 382, -1 },
+    { -1, -1, 1218, 263 },
+    { -1, 264, 1219, 266 },
+    { 1220, 798, -1, 174 },
+    { 773, 180, -1, 107 },
+    { -1, 183, 1221, 112 },
+    { -1, 806, -1, 1201 },
+    { 416, 810, -1, 1201 },
+    { -1, -1, 424, 1222 },
+    { -1, 1223, 815, 1224 },
+    { 821, 1225, -1, 1226 },
+    { -1, -1, 439, 824 },
+    { -1, 1227, -1, 444 },
+    { -1, -1, 445, 1228 },
+    { -1, 1229, 1230, 829 },
+    { -1, 836, 466, 1231 },
+    { 838, 1232, -1, 470 },
+    { 394, -1, 116, 1233 },
+    { -1, -1, -1, 398 },
+    { 123, -1, 124, 1234 },
+    { -1, -1, 126, 1235 },
+    { -1, -1, 131, 1236 },
+    { 72, -1, 73, 1237 },
+    { 1238, 1239, -1, 1240 },
+    { 83, 1241, -1, -1 },
+    { -1, -1, 89, 1242 },
+    { -1, 1243, -1, 418 },
+    { -1, 419, -1, 420 },
+    { -1, -1, 1173, 425 },
+    { -1, 426, 1174, 428 },
+    { -1, 438, 156, 102 },
+    { 305, 443, -1, 444 },
+    { -1, -1, 1244, 446 },
+    { -1, 447, 1245, 449 },
+    { -1, 192, -1, 1246 },
+    { -1, -1, 197, 1247 },
+    { -1, -1, 201, 1248 },
+    { -1, 966, 204, -1 },
+    { 671, 1249, -1, 461 },
+    { 58, -1, 59, 1250 },
+    { -1, -1, 211, 1251 },
+    { -1, 676, 677, 467 },
+    { 1176, 1252, -1, 470 },
+    { 472, 1253, -1, 1254 },
+    { 1255, 1256, -1, 477 },
+    { 479, -1, 480, -1 },
+    { 688, 326, 484, -1 },
+    { 485, -1, -1, -1 },
+    { 1257, -1, 491, 1258 },
+    { 495, 1259, 93, -1 },
+    { -1, -1, 516, -1 },
+    { 1260, -1, 521, -1 },
+    { 703, -1, 1261, 1262 },
+    { 1263, 1185, 531, -1 },
+    { 332, 171, 1264, -1 },
+    { 536, -1, 1265, -1 },
+    { 995, -1, 542, 373 },
+    { 1266, 1190, 545, -1 },
+    { -1, -1, 1267, 35 },
+    { 251, -1, 1268, -1 },
+    { 381, -1, 1269, 258 },
+    { 1270, 551, 552, -1 },
+    { 1271, 555, 556, -1 },
+    { 316, -1, 1272, -1 },
+    { 1005, -1, 1273, -1 },
+    { 1274, -1, 613, 1275 },
+    { 1276, -1, 195, 628 },
+    { 1277, -1, 73, -1 },
+    { 1278, 326, 77, -1 },
+    { 1257, -1, 87, 1279 },
+    { -1, -1, 89, -1 },
+    { 91, 1280, 93, -1 },
+    { -1, -1, -1, 373 },
+    { 1281, -1, 241, -1 },
+    { 1282, 260, 642, -1 },
+    { 643, 387, 1283, -1 },
+    { 1284, -1, 116, 927 },
+    { 118, 1285, 120, -1 },
+    { 123, -1, 124, 1286 },
+    { -1, -1, 126, -1 },
+    { 128, 1287, 33, -1 },
+    { 72, -1, 73, 1288 },
+    { 75, 916, 77, -1 },
+    { 690, -1, -1, 156 },
+    { 1289, -1, 82, -1 },
+    { 86, -1, 87, 1290 },
+    { -1, -1, 89, 1291 },
+    { 186, -1, 187, 1292 },
+    { 189, 845, 191, -1 },
+    { -1, 192, -1, -1 },
+    { 194, -1, 195, 1293 },
+    { -1, -1, 197, 1294 },
+    { -1, -1, 201, 156 },
+    { -1, 676, 1295, 678 },
+    { 861, 1296, -1, 682 },
+    { 1297, 1298, -1, 685 },
+    { -1, -1, 89, 1299 },
+    { 1300, -1, 1107, -1 },
+    { 1301, 895, 93, -1 },
+    { 1302, 498, 694, -1 },
+    { 695, -1, 1303, -1 },
+    { 156, -1, 701, -1 },
+    { -1, -1, -1, 156 },
+    { 1304, -1, 1305, -1 },
+    { 332, 171, 1306, -1 },
+    { 1307, -1, 709, 373 },
+    { -1, -1, 1308, 238 },
+    { 1044, 240, 1309, -1 },
+    { 381, -1, 1310, 258 },
+    { 1311, 716, 1046, -1 },
+    { 1312, -1, 187, -1 },
+    { 1313, 904, 191, -1 },
+    { 1314, -1, 195, 1315 },
+    { -1, -1, 197, 1316 },
+    { 199, 1317, 33, -1 },
+    { 1318, -1, 1319, 1089 },
+    { 1320, 210, 63, -1 },
+    { 1321, -1, 73, 914 },
+    { 221, 916, 77, -1 },
+    { 1322, 862, -1, 863 },
+    { 231, -1, 87, 1323 },
+    { 1324, -1, 1325, -1 },
+    { 1092, 790, 1326, -1 },
+    { 1327, -1, 1328, -1 },
+    { 1329, 895, 33, -1 },
+    { 1330, -1, 1331, 914 },
+    { 1332, 1333, 77, -1 },
+    { 1334, -1, 364, -1 },
+    { 1257, -1, 87, 919 },
+    { 1100, -1, 1309, -1 },
+    { 1335, -1, 1336, -1 },
+    { 1104, -1, 1337, -1 },
+    { 1338, -1, 943, 1108 },
+    { 1110, -1, 1339, -1 },
+    { 1112, -1, 1340, 705 },
+    { -1, 1119, -1, 1341 },
+    { -1, 573, -1, 574 },
+    { -1, 979, 965, 312 },
+    { -1, -1, 466, 1342 },
+    { -1, 175, 156, 102 },
+    { 602, -1, 1343, -1 },
+    { -1, -1, 156, 1344 },
+    { -1, -1, 815, 980 },
+    { -1, 430, -1, 431 },
+    { 468, 1150, -1, 1345 },
+    { -1, 510, 1346, 138 },
+    { -1, -1, 513, -1 },
+    { -1, -1, 1347, 149 },
+    { 1348, -1, -1, -1 },
+    { -1, -1, 1349, 182 },
+    { -1, 737, -1, 71 },
+    { -1, 1202, -1, 1350 },
+    { -1, 759, -1, 248 },
+    { 821, 273, -1, 174 },
+    { -1, 175, -1, 102 },
+    { 572, 443, -1, 107 },
+    { 779, 1210, -1, 968 },
+    { -1, 786, 1351, 138 },
+    { -1, 264, 1352, 266 },
+    { -1, 1202, -1, 1353 },
+    { -1, 1223, 815, 1354 },
+    { 821, 1225, -1, 1355 },
+    { -1, 827, -1, 444 },
+    { -1, 979, 448, 829 },
+    { 316, -1, 156, -1 },
+    { 906, -1, 907, 1279 },
+    { -1, -1, 909, -1 },
+    { -1, 918, -1, 230 },
+    { -1, 260, -1, -1 },
+    { 930, 931, 1356, -1 },
+    { 935, -1, 936, -1 },
+    { 937, 326, 939, -1 },
+    { -1, -1, -1, 487 },
+    { -1, 498, -1, -1 },
+    { 695, -1, 1357, -1 },
+    { 1358, -1, 951, 1359 },
+    { 332, 171, 156, -1 },
+    { -1, -1, 156, 238 },
+    { 381, -1, 156, 258 },
+    { 1282, 716, 552, -1 },
+    { -1, -1, 1009, 1010 },
+    { 615, -1, 169, -1 },
+    { 627, -1, 195, 1360 },
+    { 356, -1, 73, -1 },
+    { 358, 326, 77, -1 },
+    { -1, 156, -1, 1014 },
+    { -1, -1, 89, 1361 },
+    { 1362, -1, 1363, -1 },
+    { -1, -1, 197, 1364 },
+    { -1, 672, -1, 461 },
+    { 680, 361, -1, 682 },
+    { 683, 684, -1, 1365 },
+    { 688, -1, 689, -1 },
+    { 1366, -1, 1367, -1 },
+    { 1300, -1, 491, 1036 },
+    { 1368, -1, 1369, -1 },
+    { -1, -1, 1370, 705 },
+    { -1, 560, -1, -1 },
+    { -1, -1, 126, 1371 },
+    { -1, 1372, -1, 135 },
+    { 294, 1296, -1, 1373 },
+    { 1374, -1, -1, 1050 },
+    { -1, 1375, -1, 1376 },
+    { -1, -1, 201, 1377 },
+    { -1, -1, 204, 1055 },
+    { 223, 750, -1, 1378 },
+    { 752, 1379, -1, -1 },
+    { -1, -1, 1380, 1070 },
+    { -1, -1, 1381, 828 },
+    { 1318, -1, 59, 1089 },
+    { 219, -1, 73, 156 },
+    { -1, 862, -1, 863 },
+    { -1, -1, 1382, 872 },
+    { 1383, 326, 1384, -1 },
+    { -1, -1, 1385, -1 },
+    { 903, -1, 905, -1 },
+    { 1327, -1, 907, 927 },
+    { 490, -1, 87, 1386 },
+    { -1, -1, 1387, 481 },
+    { -1, -1, 1107, 1108 },
+    { 945, -1, 93, -1 },
+    { 1388, 530, 1389, -1 },
+    { 298, 566, -1, 156 },
+    { -1, 1390, 1124, 312 },
+    { 580, 1080, -1, 968 },
+    { -1, 1129, -1, 218 },
+    { -1, -1, 131, 1391 },
+    { -1, 156, -1, 975 },
+    { 416, 1054, -1, 977 },
+    { -1, -1, 156, -1 },
+    { -1, 1140, -1, 423 },
+    { -1, -1, 424, 1392 },
+    { -1, 173, -1, 174 },
+    { 459, 1146, -1, 1393 },
+    { -1, 1394, 466, 987 },
+    { 468, -1, -1, -1 },
+    { -1, 1156, 156, 138 },
+    { 1162, -1, -1, -1 },
+    { -1, -1, 1395, 182 },
+    { 995, -1, 542, 1165 },
+    { -1, -1, 156, 35 },
+    { 1396, 555, 556, -1 },
+    { 724, 1397, -1, 135 },
+    { 206, 744, -1, 156 },
+    { -1, -1, -1, 1398 },
+    { -1, 1204, -1, 174 },
+    { -1, 1205, -1, 1206 },
+    { -1, -1, 772, -1 },
+    { -1, 156, 204, 352 },
+    { 779, -1, -1, -1 },
+    { 365, 366, -1, 1399 },
+    { -1, 1213, 156, 1215 },
+    { -1, 806, -1, 156 },
+    { 416, 810, -1, 156 },
+    { -1, -1, 424, 1081 },
+    { -1, -1, 815, -1 },
+    { 821, -1, -1, -1 },
+    { -1, -1, 445, 1400 },
+    { -1, 1390, 1401, 829 },
+    { -1, 836, 466, 156 },
+    { 838, 1402, -1, 470 },
+    { 394, -1, 116, 1403 },
+    { 1238, 1239, -1, -1 },
+    { -1, -1, 89, 1404 },
+    { -1, 1405, -1, 1406 },
+    { 1257, -1, 491, 1407 },
+    { 1408, -1, 1040, -1 },
+    { -1, -1, 1261, 1262 },
+    { 1263, -1, 531, -1 },
+    { 1409, 1190, 1045, -1 },
+    { 1410, -1, 1411, 1275 },
+    { 1327, -1, 195, 628 },
+    { 1257, -1, 87, 156 },
+    { 72, -1, 73, 156 },
+    { 194, -1, 195, 1412 },
+    { -1, -1, 1107, -1 },
+    { 1301, -1, 93, -1 },
+    { 1413, -1, 1389, -1 },
+    { 1314, -1, 195, 1414 },
+    { -1, -1, 1319, 1089 },
+    { 1320, -1, 63, -1 },
+    { 1321, -1, 73, -1 },
+    { 221, 326, 77, -1 },
+    { 690, 1415, -1, 863 },
+    { 1416, -1, 1363, -1 },
+    { -1, -1, 1328, -1 },
+    { 1329, -1, 33, -1 },
+    { -1, -1, 1331, 914 },
+    { 1332, -1, 77, -1 },
+    { 1417, -1, 1367, -1 },
+    { 1300, -1, 87, 919 },
+    { 1418, -1, 1419, -1 },
+    { 1420, -1, 1421, 1108 },
+    { -1, 1422, -1, 135 },
+    { -1, -1, 965, 312 },
+    { -1, 1423, -1, 71 },
+    { -1, 1424, -1, 1350 },
+    { 821, 600, -1, 174 },
+    { -1, 1205, 156, 102 },
+    { -1, -1, 1343, -1 },
+    { -1, 1425, -1, 1353 },
+    { -1, 1128, 815, -1 },
+    { 821, 1426, -1, 1355 },
+    { -1, -1, -1, 102 },
+    { -1, 447, 1401, 449 },
+    { 468, 1427, -1, 470 },
+    { -1, 175, 1428, 102 },
+    { -1, 249, 156, 138 },
+    { -1, 1429, 1430, -1 },
+    { 1170, -1, 1431, -1 },
+    { 732, 1432, -1, 1353 },
+    { -1, 1128, -1, -1 },
+    { -1, 1433, -1, 749 },
+    { -1, 1128, 156, -1 },
+    { -1, -1, -1, 761 },
+    { -1, 766, 1434, 266 },
+    { -1, 979, -1, 112 },
+    { 779, 1435, -1, 781 },
+    { 572, 180, -1, 107 },
+    { -1, -1, 1436, 182 },
+    { -1, 1433, -1, 812 },
+    { -1, 1437, 815, 816 },
+    { 429, 1438, -1, 1439 },
+    { 821, 1440, -1, 174 },
+    { -1, 1441, 439, -1 },
+    { -1, -1, 448, 829 },
+    { -1, 1442, 156, 856 },
+    { -1, -1, 1443, 35 },
+    { -1, 249, 971, 138 },
+    { -1, 270, -1, -1 },
+    { 1170, -1, 1444, -1 },
+    { -1, 136, 1346, 138 },
+    { -1, -1, 1445, 149 },
+    { 1446, -1, -1, -1 },
+    { -1, -1, 1447, 182 },
+    { -1, -1, 1448, 35 },
+    { 637, -1, 1449, -1 },
+    { -1, -1, 1450, 258 },
+    { 1451, 931, 1356, -1 },
+    { 935, -1, 936, 156 },
+    { -1, -1, -1, 1452 },
+    { 693, -1, 946, -1 },
+    { 950, -1, 951, 1453 },
+    { 332, 171, -1, -1 },
+    { 708, -1, 955, 997 },
+    { 381, -1, -1, 258 },
+    { 1196, 555, 719, -1 },
+    { -1, 1454, -1, 761 },
+    { -1, -1, 271, -1 },
+    { -1, -1, 1455, -1 },
+    { -1, -1, 1456, 775 },
+    { -1, -1, 1457, 828 },
+    { -1, 979, 1401, 829 },
+    { 861, 361, -1, 1458 },
+    { 865, -1, -1, -1 },
+    { -1, -1, 871, 156 },
+    { 316, -1, 1459, -1 },
+    { 1096, -1, 327, -1 },
+    { 690, -1, -1, 1460 },
+    { -1, -1, -1, 230 },
+    { -1, -1, 89, 1461 },
+    { 641, 260, -1, -1 },
+    { 930, 931, 1462, -1 },
+    { -1, -1, 936, -1 },
+    { 1106, -1, 1107, 1463 },
+    { -1, -1, 493, 1464 },
+    { 693, 498, -1, -1 },
+    { 695, -1, 1465, -1 },
+    { 700, -1, -1, -1 },
+    { 1466, -1, 1113, 1359 },
+    { 332, 171, 1467, -1 },
+    { 708, -1, -1, 373 },
+    { -1, -1, 1468, 238 },
+    { 381, -1, 1469, 258 },
+    { 1470, 716, 552, -1 },
+    { -1, 1471, 1124, 1472 },
+    { -1, 1473, -1, 1439 },
+    { -1, -1, -1, 1143 },
+    { -1, -1, 1474, 182 },
+    { -1, 1213, 547, 245 },
+    { -1, 249, -1, 138 },
+    { 762, 254, -1, 255 },
+    { 381, -1, 549, -1 },
+    { -1, -1, 1475, 263 },
+    { -1, 1139, -1, 1344 },
+    { -1, -1, 1174, 980 },
+    { -1, 1476, -1, 431 },
+    { 1176, 1477, -1, 1345 },
+    { -1, 100, -1, 102 },
+    { 1478, -1, 1479, -1 },
+    { 572, 504, -1, 107 },
+    { -1, 510, 1480, 138 },
+    { -1, 150, 1481, 68 },
+    { 617, -1, -1, -1 },
+    { 1348, -1, 1186, -1 },
+    { -1, -1, 1482, 35 },
+    { 1170, -1, 1199, -1 },
+    { 821, 1483, -1, 1355 },
+    { -1, -1, 771, 1206 },
+    { -1, 1484, -1, 107 },
+    { -1, -1, 1214, 1215 },
+    { -1, 1485, -1, 248 },
+    { -1, 979, -1, 266 },
+    { 821, 798, -1, 174 },
+    { -1, 1205, 771, 102 },
+    { 1486, -1, 801, -1 },
+    { -1, 1487, -1, 1353 },
+    { -1, 1488, 1230, 1472 },
+    { -1, 283, -1, 1489 },
+    { 294, 726, -1, 1490 },
+    { 728, -1, -1, 730 },
+    { -1, 733, -1, 307 },
+    { -1, 738, -1, 1491 },
+    { -1, -1, 201, 1492 },
+    { -1, -1, 204, 743 },
+    { 206, 744, -1, -1 },
+    { -1, -1, 214, 1493 },
+    { 752, 1494, -1, 1495 },
+    { -1, 757, -1, 735 },
+    { -1, 387, -1, -1 },
+    { 602, -1, 1496, -1 },
+    { -1, 806, -1, -1 },
+    { 83, 411, -1, 1497 },
+    { 416, 810, -1, -1 },
+    { -1, 1071, 1072, 816 },
+    { -1, 818, -1, 1498 },
+    { -1, 822, -1, 174 },
+    { -1, 426, 1401, 829 },
+    { -1, 457, 204, 1497 },
+    { 833, 1499, -1, 461 },
+    { -1, -1, 211, 1500 },
+    { -1, 836, 466, -1 },
+    { 219, -1, 73, 914 },
+    { 690, -1, -1, 1458 },
+    { -1, -1, 89, 1501 },
+    { 1502, -1, 902, -1 },
+    { 915, 326, 77, -1 },
+    { 917, -1, -1, 1460 },
+    { 490, -1, 87, 1503 },
+    { -1, -1, 923, -1 },
+    { 641, 260, 1504, -1 },
+    { 1106, -1, 943, 1505 },
+    { 693, 498, 1506, -1 },
+    { 700, -1, 1504, -1 },
+    { -1, -1, 949, -1 },
+    { 1358, -1, 951, 705 },
+    { 708, -1, 1507, 373 },
+    { 1508, -1, 1006, -1 },
+    { 1509, -1, 169, -1 },
+    { 1330, -1, 73, 156 },
+    { -1, -1, -1, 1014 },
+    { 72, -1, 73, 1510 },
+    { 186, -1, 187, 156 },
+    { 194, -1, 195, 1511 },
+    { 690, -1, -1, -1 },
+    { -1, -1, 89, 1512 },
+    { 1035, -1, 491, 1513 },
+    { -1, -1, -1, 705 },
+    { 1514, 240, 1045, -1 },
+    { 280, -1, 116, 156 },
+    { -1, -1, 126, 1515 },
+    { 294, 1516, -1, -1 },
+    { -1, -1, 89, 1517 },
+    { -1, 1051, -1, -1 },
+    { 58, -1, 59, 1518 },
+    { 223, 1296, -1, 1519 },
+    { 1374, -1, -1, 156 },
+    { -1, -1, -1, 1067 },
+    { 407, 1239, -1, 1240 },
+    { 83, 411, -1, -1 },
+    { -1, -1, 1520, -1 },
+    { -1, 457, 204, -1 },
+    { -1, -1, 211, 156 },
+    { -1, -1, 677, -1 },
+    { 475, 1256, -1, 1085 },
+    { 219, -1, 73, -1 },
+    { 231, -1, 87, 1521 },
+    { -1, -1, -1, 872 },
+    { 1522, 790, 1093, -1 },
+    { 1300, -1, 87, -1 },
+    { 91, 895, 93, -1 },
+    { 156, -1, 1101, -1 },
+    { -1, -1, -1, 481 },
+    { 1523, -1, 1105, -1 },
+    { 1524, -1, 93, -1 },
+    { 156, -1, 1111, -1 },
+    { 1525, -1, 1113, 705 },
+    { 394, -1, 116, 1526 },
+    { 123, -1, 124, 1527 },
+    { 72, -1, 73, 1528 },
+    { 690, -1, -1, 1529 },
+    { -1, 1241, -1, -1 },
+    { -1, -1, 89, 1530 },
+    { 154, -1, 155, -1 },
+    { 157, 326, 159, -1 },
+    { 162, -1, 163, 1531 },
+    { 186, -1, 187, 1532 },
+    { -1, -1, 201, 1533 },
+    { 472, 1296, -1, 1254 },
+    { 1300, -1, 491, -1 },
+    { 495, 895, 93, -1 },
+    { 1534, -1, 531, -1 },
+    { 72, -1, 73, -1 },
+    { 75, 326, 77, -1 },
+    { 86, -1, 87, 1535 },
+    { 186, -1, 187, -1 },
+    { 189, 904, 191, -1 },
+    { 194, -1, 195, 1536 },
+    { -1, -1, 197, 1537 },
+    { 1318, -1, 59, 673 },
+    { 1327, -1, 195, -1 },
+    { 199, 895, 33, -1 },
+    { 1538, -1, 63, -1 },
+    { 1330, -1, 73, 914 },
+    { 1539, -1, 33, -1 },
+    { 1540, -1, 77, -1 },
+    { -1, 314, -1, 71 },
+    { -1, 983, -1, 444 },
+    { 1000, -1, 552, -1 },
+    { -1, 763, -1, 764 },
+    { -1, 830, -1, 71 },
+    { 316, -1, -1, -1 },
+    { -1, 618, 898, -1 },
+    { -1, -1, 382, 258 },
+    { 930, 931, -1, -1 },
+    { -1, 451, -1, 71 },
+    { -1, -1, 698, -1 },
+    { 536, -1, -1, -1 },
+    { -1, 268, -1, 71 },
+    { -1, 443, -1, 107 },
+    { -1, 247, -1, 248 },
+    { -1, 240, -1, -1 },
+    { -1, 790, -1, -1 },
+    { 1330, -1, 1331, -1 },
+    { -1, -1, -1, 362 },
+    { -1, 1029, -1, -1 },
+    { -1, 684, -1, 1365 },
+    { -1, -1, 491, 1036 },
+    { 495, -1, 93, -1 },
+    { 83, -1, -1, -1 },
+    { -1, 1083, -1, 470 },
+    { -1, -1, 59, 1089 },
+    { 61, -1, 63, -1 },
+    { -1, -1, 907, 927 },
+    { 910, -1, 33, -1 },
+    { 1099, -1, 77, -1 },
+    { 298, 566, -1, -1 },
+    { -1, 1390, -1, 312 },
+    { 580, -1, -1, 968 },
+    { -1, -1, 211, -1 },
+    { -1, -1, 131, -1 },
+    { -1, -1, -1, 975 },
+    { 416, -1, -1, 977 },
+    { 459, 1146, -1, -1 },
+    { -1, -1, 466, 987 },
+    { 769, -1, 271, -1 },
+    { 795, -1, 796, -1 },
+    { 688, -1, 484, -1 },
+    { -1, -1, 195, 628 },
+    { 629, -1, 33, -1 },
+    { 1278, -1, 77, -1 },
+    { -1, 1296, -1, 682 },
+    { 1313, -1, 191, -1 },
+    { -1, -1, 87, 919 },
+    { 91, -1, 93, -1 },
+    { -1, 1205, -1, 102 },
+    { 732, -1, -1, -1 },
+    { -1, 273, -1, 174 },
+    { 429, -1, -1, -1 },
+    { -1, -1, 439, -1 },
+    { 1451, 931, -1, -1 },
+    { -1, -1, -1, 997 },
+    { -1, -1, 1124, -1 },
+    { -1, 98, -1, 99 },
+    { 1176, -1, -1, -1 },
+    { -1, 798, -1, 174 },
+    { -1, -1, 801, -1 },
+    { -1, -1, 1230, -1 },
+    { -1, 283, -1, -1 },
+    { 752, 1494, -1, -1 },
+    { -1, -1, 204, 352 },
+    { -1, 780, -1, 781 },
+    { -1, -1, -1, 1458 },
+    { -1, -1, 902, -1 },
+    { -1, -1, 943, 1505 },
+    { -1, -1, 73, 156 },
+    { 358, -1, 77, -1 },
+    { 407, 1239, -1, -1 },
+    { -1, -1, 87, -1 },
+    { -1, -1, -1, 1529 },
+    { -1, 966, -1, -1 },
+    { -1, -1, 491, -1 },
+    { -1, -1, 59, 673 },
+    { -1, -1, 195, -1 },
+    { 199, -1, 33, -1 },
+    { -1, -1, 73, 914 },
+    { 221, -1, 77, -1 },
+    { -1, 979, 965, -1 },
+    { -1, 183, -1, 112 },
+    { -1, -1, 448, 449 },
+    { -1, -1, 767, 266 },
+    { -1, -1, 376, 245 },
+    { -1, 979, 448, -1 },
+    { 637, -1, -1, -1 },
+    { -1, -1, -1, 238 },
+    { 957, -1, 545, -1 },
+    { -1, 716, 552, -1 },
+    { -1, -1, 596, 266 },
+    { -1, 979, -1, -1 },
+    { -1, -1, 993, -1 },
+    { -1, 979, 1174, -1 },
+    { -1, 1197, 719, -1 },
+    { -1, 1205, 771, -1 },
+    { -1, -1, 776, 112 },
+    { -1, 114, -1, 71 },
+    { -1, 1213, 1214, -1 },
+    { -1, -1, -1, 138 },
+    { -1, 438, -1, 102 },
+    { 497, -1, 499, -1 },
+    { -1, 551, -1, -1 },
+    { -1, 618, 1012, -1 },
+    { -1, -1, 1020, 258 },
+    { 643, 387, -1, -1 },
+    { -1, 498, 694, -1 },
+    { -1, -1, 701, -1 },
+    { -1, -1, 524, -1 },
+    { -1, -1, 709, 373 },
+    { -1, 854, -1, 781 },
+    { -1, 156, -1, 362 },
+    { -1, 1156, -1, 138 },
+    { -1, -1, 552, -1 },
+    { -1, 555, 556, -1 },
+    { -1, -1, 796, -1 },
+    { 671, -1, -1, -1 },
+    { 1005, -1, -1, -1 },
+    { -1, -1, -1, 461 },
+    { 1297, -1, -1, 685 },
+    { 1044, 240, -1, -1 },
+    { 690, -1, -1, 863 },
+    { -1, -1, -1, 867 },
+    { 1092, 790, -1, -1 },
+    { -1, -1, 1331, -1 },
+    { 1100, -1, -1, -1 },
+    { 1104, -1, -1, -1 },
+    { 1110, -1, -1, -1 },
+    { 1112, -1, -1, 705 },
+    { -1, -1, 156, 102 },
+    { -1, 180, -1, 107 },
+    { -1, -1, -1, 112 },
+    { -1, 931, 1356, -1 },
+    { 332, -1, -1, -1 },
+    { -1, 447, -1, 112 },
+    { -1, -1, 1401, 829 },
+    { -1, -1, 257, 258 },
+    { 1092, -1, 1093, -1 },
+    { -1, -1, 1459, -1 },
+    { 620, -1, -1, -1 },
+    { 693, -1, -1, -1 },
+    { -1, -1, 547, 245 },
+    { -1, 264, -1, 266 },
+    { -1, 507, -1, 112 },
+    { 639, -1, -1, -1 },
+    { -1, -1, -1, 266 },
+    { -1, -1, 771, 102 },
+    { -1, 1119, -1, -1 },
+    { 580, -1, -1, 208 },
+    { -1, -1, -1, 404 },
+    { 416, -1, -1, 418 },
+    { -1, 443, -1, 444 },
+    { -1, -1, 466, 467 },
+    { 468, 1150, -1, -1 },
+    { -1, 716, -1, -1 },
+    { -1, 1202, -1, -1 },
+    { 779, 1210, -1, -1 },
+    { -1, 1223, 815, -1 },
+    { 821, 1225, -1, -1 },
+    { 1255, -1, -1, 477 },
+    { 1284, -1, 116, -1 },
+    { 861, -1, -1, 682 },
+    { -1, -1, 1305, -1 },
+    { 1322, -1, -1, 863 },
+    { -1, -1, 1325, -1 },
+    { -1, -1, 1336, -1 },
+    { -1, -1, -1, 1010 },
+    { 367, -1, 87, -1 },
+    { -1, 1375, -1, -1 },
+    { 407, 408, -1, -1 },
+    { 475, -1, -1, -1 },
+    { -1, -1, -1, 863 },
+    { -1, -1, -1, 1108 },
+    { 298, -1, -1, 156 },
+    { -1, -1, 204, 156 },
+    { 588, 589, -1, -1 },
+    { -1, 432, -1, -1 },
+    { 459, -1, -1, 1393 },
+    { 789, -1, 791, -1 },
+    { 472, -1, -1, -1 },
+    { -1, -1, -1, 1262 },
+    { -1, -1, -1, 1089 },
+    { 231, -1, 87, -1 },
+    { -1, -1, -1, 914 },
+    { -1, -1, -1, 1489 },
+    { 294, 726, -1, -1 },
+    { -1, 738, -1, -1 },
+    { -1, 744, -1, -1 },
+    { 752, -1, -1, 1495 },
+    { 360, -1, -1, 362 },
+    { -1, -1, -1, 805 },
+    { -1, 810, -1, -1 },
+    { 490, -1, 87, -1 },
+    { 223, -1, -1, -1 },
+    { 407, -1, -1, 1240 },
+    { -1, 411, -1, -1 },
+    { 162, -1, 163, -1 },
+    { 86, -1, 87, -1 },
+    { 194, -1, 195, -1 },
+};
+
+// Operador do movimento que leva o vazio de 'vazio' para 'destino'
+inline int operador(int vazio, int destino) {
+    int d = destino - vazio;
+    return d == -1 ? 0 : d == 1 ? 1 : d == -2 ? 2 : 3;
+}
+
+inline int proximo(int estado, int vazio, int destino) {
+    return TRANSICOES[estado][operador(vazio, destino)];
+}
+
+} // namespace AutomatoPoda
+
+#endif
@@ -0,0 +1,263 @@
+#include "Caminho.h"
+#include "Solver.h"
+#include <cstdio>
+#include <cstdlib>
+
+// Codigos de 2 bits: deslocamento da ficha em relacao ao vazio
+static const int DESLOCAMENTOS[4] = { -2, -1, 1, 2 };
+
+static int codigoDoDeslocamento(int deslocamento) {
+    switch (deslocamento) {
+        case -2: return 0;
+        case -1: return 1;
+        case 1: return 2;
+        case 2: return 3;
+        default: return -1;
+    }
+}
+
+// --- CaminhoCompacto ---
+
+CaminhoCompacto::Iterador::Iterador(const CaminhoCompacto* caminho, size_t indice, int vazio)
+    : caminho(caminho) {
+    passo.indice = (int)indice;
+    passo.vazio = vazio;
+    passo.posicao = -1;
+    decodificar();
+}
+
+void CaminhoCompacto::Iterador::decodificar() {
+    if ((size_t)passo.indice < caminho->quantidade) {
+        passo.posicao = passo.vazio + DESLOCAMENTOS[caminho->codigo(passo.indice)];
+    }
+}
+
+CaminhoCompacto::Iterador& CaminhoCompacto::Iterador::operator++() {
+    // A ficha movida deixa seu lugar vazio
+    passo.vazio = passo.posicao;
+    passo.indice++;
+    decodificar();
+    return *this;
+}
+
+CaminhoCompacto::CaminhoCompacto() : quantidade(0), vazioInicio(-1), vazioFim(-1) {}
+
+CaminhoCompacto::CaminhoCompacto(int vazioInicial)
+    : quantidade(0), vazioInicio(vazioInicial), vazioFim(vazioInicial) {}
+
+CaminhoCompacto CaminhoCompacto::deCaminho(const std::vector<char>& tabuleiroInicial, const std::vector<int>& caminho) {
+    int vazio = -1;
+    for (size_t i = 0; i < tabuleiroInicial.size(); ++i) {
+        if (tabuleiroInicial[i] == '_') {
+            vazio = (int)i;
+            break;
+        }
+    }
+    return deCaminho(vazio, caminho);
+}
+
+CaminhoCompacto CaminhoCompacto::deCaminho(int vazioInicial, const std::vector<int>& caminho) {
+    CaminhoCompacto compacto(vazioInicial);
+    compacto.dados.reserve((caminho.size() + 3) / 4);
+    for (int posicao : caminho) {
+        if (!compacto.adicionar(posicao)) break;
+    }
+    return compacto;
+}
+
+bool CaminhoCompacto::adicionar(int posicao) {
+    int c = codigoDoDeslocamento(posicao - vazioFim);
+    if (c < 0) return false;
+    if ((quantidade & 3) == 0) dados.push_back(0);
+    dados.back() |= (uint8_t)(c << ((quantidade & 3) * 2));
+    quantidade++;
+    vazioFim = posicao;
+    return true;
+}
+
+void CaminhoCompacto::remover() {
+    if (quantidade == 0) return;
+    quantidade--;
+    // A ficha veio de vazio + deslocamento e agora ocupa o vazio anterior
+    vazioFim -= DESLOCAMENTOS[codigo(quantidade)];
+    if ((quantidade & 3) == 0) {
+        dados.pop_back();
+    } else {
+        dados.back() &= (uint8_t)((1u << ((quantidade & 3) * 2)) - 1);
+    }
+}
+
+std::vector<int> CaminhoCompacto::paraCaminho() const {
+    std::vector<int> caminho;
+    caminho.reserve(quantidade);
+    for (Iterador it = begin(); it != end(); ++it) {
+        caminho.push_back(it->posicao);
+    }
+    return caminho;
+}
+
+// --- RenderizadorSolucao ---
+
+RenderizadorSolucao::RenderizadorSolucao(std::ostream& saida, NivelDetalhe nivel)
+    : saida(saida), nivel(nivel) {
+    buffer.reserve(TAMANHO_BUFFER + 4096);
+}
+
+RenderizadorSolucao::~RenderizadorSolucao() {
+    descarregar();
+}
+
+void RenderizadorSolucao::descarregar() {
+    if (!buffer.empty()) {
+        saida.write(buffer.data(), (std::streamsize)buffer.size());
+        buffer.clear();
+    }
+    saida.flush();
+}
+
+void RenderizadorSolucao::verificarBuffer() {
+    if (buffer.size() >= TAMANHO_BUFFER) {
+        saida.write(buffer.data(), (std::streamsize)buffer.size());
+        buffer.clear();
+    }
+}
+
+void RenderizadorSolucao::anexar(const char* texto) { buffer += texto; }
+void RenderizadorSolucao::anexar(const std::string& texto) { buffer += texto; }
+void RenderizadorSolucao::anexar(char c) { buffer += c; }
+
+void RenderizadorSolucao::anexarInteiro(long long valor) {
+    char tmp[24];
+    int n = 0;
+    bool negativo = valor < 0;
+    unsigned long long v = negativo ? 0ULL - (unsigned long long)valor : (unsigned long long)valor;
+    do {
+        tmp[n++] = (char)('0' + v % 10);
+        v /= 10;
+    } while (v > 0);
+    if (negativo) buffer += '-';
+    while (n > 0) buffer += tmp[--n];
+}
+
+void RenderizadorSolucao::anexarDecimal(double valor) {
+    // Mesmo formato padrao do std::cout (6 digitos significativos)
+    char tmp[32];
+    std::snprintf(tmp, sizeof(tmp), "%g", valor);
+    buffer += tmp;
+}
+
+void RenderizadorSolucao::anexarTabuleiro(const std::vector<char>& tabuleiro) {
+    buffer += borda;
+    buffer += "\n|";
+    for (char c : tabuleiro) {
+        buffer += c;
+        buffer += '|';
+    }
+    buffer += '\n';
+    buffer += borda;
+    buffer += '\n';
+    buffer += indices;
+    buffer += "\n\n";
+}
+
+void RenderizadorSolucao::anexarEstatisticas(const SolverStats& stats, size_t numMovimentos) {
+    anexar("\n=== ESTATISTICAS ===\n");
+    anexar("Numero de movimentos: "); anexarInteiro((long long)numMovimentos); anexar('\n');
+    anexar("Profundidade da solucao: "); anexarInteiro(stats.profundidade); anexar('\n');
+    anexar("Custo da solucao: "); anexarInteiro(stats.custo); anexar('\n');
+    anexar("Nos expandidos: "); anexarInteiro(stats.nos_expandidos); anexar('\n');
+    anexar("Nos visitados: "); anexarInteiro(stats.nos_visitados); anexar('\n');
+    anexar("Fator medio de ramificacao: "); anexarDecimal(stats.fator_ramificacao); anexar('\n');
+    if (stats.pico_nos > 0) {
+        anexar("Pico de estados na memoria: "); anexarInteiro(stats.pico_nos); anexar('\n');
+    }
+    if (stats.movimentos_podados > 0) {
+        anexar("Movimentos podados pelo automato: "); anexarInteiro(stats.movimentos_podados); anexar('\n');
+    }
+    if (stats.estados_perimetro > 0) {
+        anexar("Estados no perimetro dos objetivos: "); anexarInteiro(stats.estados_perimetro); anexar('\n');
+    }
+    if (stats.arena_alocacoes > 0) {
+        anexar("Arena da busca: "); anexarInteiro(stats.arena_alocacoes);
+        anexar(" alocacoes, pico de "); anexarInteiro(stats.arena_pico_bytes / 1024); anexar(" KB\n");
+    }
+    if (stats.memoria_esgotada) {
+        anexar("Busca interrompida: limite de memoria da arena\n");
+    }
+    if (stats.nos_reabertos > 0) {
+        anexar("Nos reabertos: "); anexarInteiro(stats.nos_reabertos); anexar('\n');
+    }
+    if (stats.expandidos_ultima_camada > 0) {
+        anexar("Expandidos na ultima camada de f: "); anexarInteiro(stats.expandidos_ultima_camada); anexar('\n');
+    }
+    anexar("Tempo de execucao: "); anexarDecimal(stats.tempo_execucao); anexar(" segundos");
+    anexar(" (CPU: "); anexarDecimal(stats.tempo_cpu); anexar(" s)\n\n");
+    if (stats.camadas.empty()) return;
+
+    anexar("=== HISTOGRAMA POR CAMADA (");
+    anexar(stats.tipo_camada);
+    anexar(") ===\n");
+    char linha[160];
+    std::snprintf(linha, sizeof(linha), "%8s %14s %14s %14s %10s %10s\n",
+                  "camada", "expandidos", "gerados", "duplicados", "ramif.", "efetiva");
+    anexar(linha);
+    for (const CamadaBusca& c : stats.camadas) {
+        std::snprintf(linha, sizeof(linha), "%8d %14lld %14lld %14lld %10.3f %10.3f\n", c.camada,
+                      c.expandidos, c.gerados, c.duplicados, c.ramificacao, c.ramificacao_efetiva);
+        anexar(linha);
+        verificarBuffer();
+    }
+    anexar('\n');
+}
+
+void RenderizadorSolucao::renderizar(const std::vector<char>& tabuleiroInicial, const CaminhoCompacto& caminho,
+                                     const SolverStats& stats) {
+    if (caminho.empty()) {
+        anexar("Nenhuma solucao encontrada!\n");
+        descarregar();
+        return;
+    }
+
+    int tamanho = (int)tabuleiroInicial.size();
+    borda = "+";
+    indices = " ";
+    for (int i = 0; i < tamanho; ++i) {
+        borda += "-+";
+        indices += std::to_string(i);
+        indices += ' ';
+    }
+
+    // O tabuleiro e atualizado no lugar: cada movimento troca a ficha com o vazio
+    std::vector<char> tabuleiroAtual = tabuleiroInicial;
+
+    if (nivel == DETALHE_COMPLETO) {
+        anexar("Estado inicial:\n");
+        anexarTabuleiro(tabuleiroAtual);
+        for (CaminhoCompacto::Iterador it = caminho.begin(); it != caminho.end(); ++it) {
+            std::swap(tabuleiroAtual[it->posicao], tabuleiroAtual[it->vazio]);
+            anexar("Movimento "); anexarInteiro(it->indice + 1);
+            anexar(" (posicao "); anexarInteiro(it->posicao); anexar("):\n");
+            anexarTabuleiro(tabuleiroAtual);
+            verificarBuffer();
+        }
+        anexar("Solucao completa!\n");
+    } else if (nivel == DETALHE_COMPACTO) {
+        anexar("Estado inicial: ");
+        buffer.append(tabuleiroAtual.begin(), tabuleiroAtual.end());
+        anexar('\n');
+        for (CaminhoCompacto::Iterador it = caminho.begin(); it != caminho.end(); ++it) {
+            std::swap(tabuleiroAtual[it->posicao], tabuleiroAtual[it->vazio]);
+            anexarInteiro(it->indice + 1);
+            anexar(". posicao ");
+            anexarInteiro(it->posicao);
+            anexar(": ");
+            buffer.append(tabuleiroAtual.begin(), tabuleiroAtual.end());
+            anexar('\n');
+            verificarBuffer();
+        }
+        anexar("Solucao completa!\n");
+    }
+
+    anexarEstatisticas(stats, caminho.size());
+    descarregar();
+}
@@ -0,0 +1,116 @@
+#ifndef CAMINHO_H
+#define CAMINHO_H
+
+#include <vector>
+#include <string>
+#include <ostream>
+#include <cstdint>
+#include <cstddef>
+#include <iterator>
+
+struct SolverStats;
+
+// Caminho de solucao compactado: cada movimento ocupa 2 bits e e guardado
+// relativo ao espaco vazio (a ficha que se move esta em vazio-2, vazio-1,
+// vazio+1 ou vazio+2). A posicao absoluta e recuperada durante a iteracao,
+// ja que depois de cada movimento o vazio passa a ocupar a posicao da ficha.
+// E o formato de SolverStats::caminho e da pilha das buscas em profundidade.
+class CaminhoCompacto {
+public:
+    // Um passo decodificado
+    struct Passo {
+        int indice;   // numero do movimento (0, 1, 2, ...)
+        int posicao;  // posicao absoluta da ficha movida
+        int vazio;    // posicao do vazio antes do movimento
+    };
+
+    class Iterador {
+    public:
+        typedef std::input_iterator_tag iterator_category;
+        typedef Passo value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const Passo* pointer;
+        typedef const Passo& reference;
+
+        Iterador(const CaminhoCompacto* caminho, size_t indice, int vazio);
+        const Passo& operator*() const { return passo; }
+        const Passo* operator->() const { return &passo; }
+        Iterador& operator++();
+        bool operator==(const Iterador& outro) const { return passo.indice == outro.passo.indice; }
+        bool operator!=(const Iterador& outro) const { return passo.indice != outro.passo.indice; }
+
+    private:
+        void decodificar();
+        const CaminhoCompacto* caminho;
+        Passo passo;
+    };
+
+    CaminhoCompacto();
+    explicit CaminhoCompacto(int vazioInicial);
+
+    // Converte um caminho de posicoes absolutas
+    static CaminhoCompacto deCaminho(const std::vector<char>& tabuleiroInicial, const std::vector<int>& caminho);
+    static CaminhoCompacto deCaminho(int vazioInicial, const std::vector<int>& caminho);
+
+    // Acrescenta um movimento; retorna false se a posicao nao for vizinha do vazio
+    bool adicionar(int posicao);
+    // Desfaz o ultimo movimento (o vazio volta para onde estava)
+    void remover();
+    std::vector<int> paraCaminho() const;
+
+    size_t size() const { return quantidade; }
+    bool empty() const { return quantidade == 0; }
+    int vazioInicial() const { return vazioInicio; }
+    int vazioFinal() const { return vazioFim; }
+    size_t bytesOcupados() const { return dados.size(); }
+
+    Iterador begin() const { return Iterador(this, 0, vazioInicio); }
+    Iterador end() const { return Iterador(this, quantidade, vazioFim); }
+
+private:
+    int codigo(size_t i) const { return (dados[i >> 2] >> ((i & 3) * 2)) & 3; }
+
+    std::vector<uint8_t> dados;
+    size_t quantidade;
+    int vazioInicio;
+    int vazioFim;
+};
+
+// Nivel de detalhe da exibicao de uma solucao
+enum NivelDetalhe {
+    DETALHE_RESUMO = 1,   // apenas as estatisticas
+    DETALHE_COMPACTO = 2, // uma linha por movimento
+    DETALHE_COMPLETO = 3  // tabuleiro desenhado a cada movimento
+};
+
+// Desenha a solucao em um buffer unico e o descarrega no fluxo de saida em
+// blocos grandes, em vez de milhares de escritas pequenas.
+class RenderizadorSolucao {
+public:
+    explicit RenderizadorSolucao(std::ostream& saida, NivelDetalhe nivel = DETALHE_COMPLETO);
+    ~RenderizadorSolucao();
+
+    void renderizar(const std::vector<char>& tabuleiroInicial, const CaminhoCompacto& caminho,
+                    const SolverStats& stats);
+    void descarregar();
+
+private:
+    static const size_t TAMANHO_BUFFER = 1 << 16;
+
+    void anexar(const char* texto);
+    void anexar(const std::string& texto);
+    void anexar(char c);
+    void anexarInteiro(long long valor);
+    void anexarDecimal(double valor);
+    void anexarTabuleiro(const std::vector<char>& tabuleiro);
+    void anexarEstatisticas(const SolverStats& stats, size_t numMovimentos);
+    void verificarBuffer();
+
+    std::ostream& saida;
+    NivelDetalhe nivel;
+    std::string buffer;
+    std::string borda;   // "+-+-+...+" pre-montada para o tamanho do tabuleiro
+    std::string indices; // " 0 1 2 ..." pre-montada para o tamanho do tabuleiro
+};
+
+#endif
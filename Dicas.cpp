@@ -0,0 +1,151 @@
+#include "Dicas.h"
+#include "Solver.h"
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+
+size_t MotorDicas::HashTexto::operator()(const std::string& s) const {
+    // FNV-1a seguido de uma multiplicacao, para espalhar tambem os bits altos
+    uint64_t h = 1469598103934665603ULL;
+    for (char c : s) {
+        h ^= (unsigned char)c;
+        h *= 1099511628211ULL;
+    }
+    h ^= h >> 32;
+    h *= 0x9e3779b97f4a7c15ULL;
+    return (size_t)(h ^ (h >> 29));
+}
+
+MotorDicas::MotorDicas(const std::string& arquivo, double orcamento)
+    : arquivo(arquivo), orcamento(orcamento), nos(0), interrompida(false) {}
+
+// h aprendido, se houver, ou o numero de inversoes (0 apenas no objetivo)
+int MotorDicas::valor(const std::vector<char>& tabuleiro) {
+    int base = Solver::heuristicaInversoes(tabuleiro);
+    if (base == 0) return 0;
+    chave.assign(tabuleiro.begin(), tabuleiro.end());
+    const int* v = aprendido.procurar(chave);
+    return v ? std::max(*v, base) : base;
+}
+
+void MotorDicas::registrar(const std::vector<char>& tabuleiro, int novo) {
+    // Valores que nao superam as inversoes nao precisam ser guardados
+    if (novo <= Solver::heuristicaInversoes(tabuleiro)) return;
+    chave.assign(tabuleiro.begin(), tabuleiro.end());
+    std::pair<int*, bool> r = aprendido.inserir(chave, novo);
+    if (!r.second && *r.first < novo) *r.first = novo;
+}
+
+// Menor g + h na fronteira a 'profundidade' movimentos, sem desfazer o ultimo movimento.
+int MotorDicas::avaliar(std::vector<char>& tabuleiro, int vazio, int proibido, int profundidade) {
+    if ((++nos & 1023) == 0 && !interrompida) {
+        double decorrido = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - inicio).count();
+        if (decorrido > orcamento) interrompida = true;
+    }
+    if (interrompida || profundidade == 0) return valor(tabuleiro);
+    if (Solver::heuristicaInversoes(tabuleiro) == 0) return 0;
+
+    const int INFINITO = 0x3fffffff;
+    const int deslocamentos[4] = { -1, 1, -2, 2 };
+    int tamanho = (int)tabuleiro.size();
+    int melhor = INFINITO;
+    for (int k = 0; k < 4; ++k) {
+        int p = vazio + deslocamentos[k];
+        if (p < 0 || p >= tamanho || p == proibido) continue;
+        std::swap(tabuleiro[p], tabuleiro[vazio]);
+        melhor = std::min(melhor, 1 + avaliar(tabuleiro, p, vazio, profundidade - 1));
+        std::swap(tabuleiro[p], tabuleiro[vazio]);
+    }
+    // O h aprendido de um estado interno tambem e um limite inferior: vale o maior dos dois
+    return std::max(melhor < INFINITO ? melhor : 0, valor(tabuleiro));
+}
+
+// Valor do estado pelo horizonte 'profundidade' e a ficha do melhor primeiro movimento.
+// Empates ficam com o filho de menos inversoes.
+int MotorDicas::melhorFilho(std::vector<char>& tabuleiro, int profundidade, int& posicao) {
+    const int INFINITO = 0x3fffffff;
+    const int deslocamentos[4] = { -1, 1, -2, 2 };
+    int tamanho = (int)tabuleiro.size();
+    int vazio = Solver::encontrarEspacoVazio(tabuleiro);
+    int melhor = INFINITO;
+    int melhorInversoes = INFINITO;
+    posicao = -1;
+    for (int k = 0; k < 4; ++k) {
+        int p = vazio + deslocamentos[k];
+        if (p < 0 || p >= tamanho) continue;
+        std::swap(tabuleiro[p], tabuleiro[vazio]);
+        int v = 1 + avaliar(tabuleiro, p, vazio, profundidade - 1);
+        int inversoes = Solver::heuristicaInversoes(tabuleiro);
+        std::swap(tabuleiro[p], tabuleiro[vazio]);
+        if (v < melhor || (v == melhor && inversoes < melhorInversoes)) {
+            melhor = v;
+            melhorInversoes = inversoes;
+            posicao = p;
+        }
+    }
+    return melhor;
+}
+
+MotorDicas::Dica MotorDicas::sugerir(const std::vector<char>& tabuleiroAtual) {
+    Dica dica = { -1, 0, 0 };
+    if (Solver::encontrarEspacoVazio(tabuleiroAtual) < 0 || Solver::heuristicaInversoes(tabuleiroAtual) == 0) {
+        return dica;
+    }
+    std::vector<char> tabuleiro = tabuleiroAtual;
+    inicio = std::chrono::high_resolution_clock::now();
+    nos = 0;
+    interrompida = false;
+
+    // Aprofundamento iterativo: vale o resultado da ultima profundidade completa
+    for (int profundidade = 1; profundidade <= HORIZONTE_MAXIMO; ++profundidade) {
+        int posicao;
+        int v = melhorFilho(tabuleiro, profundidade, posicao);
+        if (interrompida && dica.posicao >= 0) break;
+        dica.posicao = posicao;
+        dica.estimativa = v - 1;
+        dica.horizonte = profundidade;
+        registrar(tabuleiro, v);
+        // Objetivo dentro do horizonte: um horizonte maior nao acharia caminho mais curto
+        if (interrompida || v <= profundidade) break;
+    }
+    return dica;
+}
+
+void MotorDicas::aprender(const std::vector<char>& tabuleiroAnterior) {
+    if (Solver::encontrarEspacoVazio(tabuleiroAnterior) < 0 || Solver::heuristicaInversoes(tabuleiroAnterior) == 0) {
+        return;
+    }
+    std::vector<char> tabuleiro = tabuleiroAnterior;
+    inicio = std::chrono::high_resolution_clock::now();
+    nos = 0;
+    interrompida = false;
+    int posicao;
+    registrar(tabuleiro, melhorFilho(tabuleiro, 1, posicao));
+}
+
+bool MotorDicas::carregar() {
+    std::ifstream entrada(arquivo.c_str());
+    if (!entrada) return false;
+    std::string linha;
+    while (std::getline(entrada, linha)) {
+        if (linha.empty() || linha[0] == '#') continue;
+        std::istringstream campos(linha);
+        std::string estado;
+        int v;
+        if (!(campos >> estado >> v)) continue;
+        if (estado.find_first_not_of("AB_") != std::string::npos) continue;
+        registrar(std::vector<char>(estado.begin(), estado.end()), v);
+    }
+    return true;
+}
+
+bool MotorDicas::salvar() const {
+    if (aprendido.empty()) return true;
+    std::ofstream saida(arquivo.c_str(), std::ios::out | std::ios::trunc);
+    if (!saida) return false;
+    saida << "# Tabela aprendida das dicas (estado valor)\n";
+    aprendido.paraCada([&saida](const std::string& estado, int v) {
+        saida << estado << ' ' << v << '\n';
+    });
+    return (bool)saida;
+}
@@ -0,0 +1,66 @@
+#ifndef DICAS_H
+#define DICAS_H
+
+#include <vector>
+#include <string>
+#include <cstddef>
+#include <cstdint>
+#include <chrono>
+#include "TabelaHash.h"
+
+// Motor de dicas para o jogo interativo, no estilo LRTA*.
+//
+// Cada dica faz uma busca com horizonte limitado a partir do estado atual
+// (aprofundamento iterativo dentro de um orcamento de tempo fixo) e sugere o
+// movimento cujo valor g + h na fronteira e o menor. O valor h de um estado e
+// o aprendido, se houver, ou o numero de inversoes (admissivel). O estado da
+// dica, e cada estado que o jogador deixa ao jogar, tem o h aprendido elevado
+// para o melhor valor encontrado no horizonte, que continua admissivel.
+//
+// A tabela aprendida e gravada em um arquivo texto (uma linha "estado valor"
+// por entrada) e carregada na proxima sessao, de modo que as dicas ficam mais
+// precisas com o uso, enquanto o tempo por dica continua constante.
+class MotorDicas {
+public:
+    struct Dica {
+        int posicao;      // ficha a mover, ou -1 se nao houver movimento
+        int estimativa;   // movimentos restantes estimados depois do sugerido
+        int horizonte;    // profundidade da ultima busca completa
+    };
+
+    explicit MotorDicas(const std::string& arquivo = "dicas_regua.txt", double orcamento = 0.05);
+
+    Dica sugerir(const std::vector<char>& tabuleiro);
+    // Atualizacao LRTA* (horizonte 1) do estado que o jogador acabou de deixar
+    void aprender(const std::vector<char>& tabuleiro);
+
+    bool carregar();
+    bool salvar() const;
+
+    void definirOrcamento(double segundos) { orcamento = segundos; }
+    size_t tamanhoTabela() const { return aprendido.size(); }
+
+private:
+    static const int HORIZONTE_MAXIMO = 64;
+
+    struct HashTexto {
+        size_t operator()(const std::string& s) const;
+    };
+
+    int valor(const std::vector<char>& tabuleiro);
+    void registrar(const std::vector<char>& tabuleiro, int valor);
+    int avaliar(std::vector<char>& tabuleiro, int vazio, int proibido, int profundidade);
+    int melhorFilho(std::vector<char>& tabuleiro, int profundidade, int& posicao);
+
+    std::string arquivo;
+    double orcamento;
+    MapaPlano<std::string, int, HashTexto> aprendido;
+
+    // Estado da busca em andamento
+    std::string chave;
+    long long nos;
+    bool interrompida;
+    std::chrono::high_resolution_clock::time_point inicio;
+};
+
+#endif
@@ -0,0 +1,810 @@
+#include "Distribuido.h"
+#include "TabelaHash.h"
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <cstring>
+#include <cstdlib>
+#include <cerrno>
+#include <csignal>
+#include <iostream>
+#include <unistd.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <netdb.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+
+namespace {
+
+const uint64_t NENHUM = ~0ULL;
+const int BIT_VAZIO = 58;
+
+// Mensagens: cabecalho (tipo, numero de palavras) e palavras de 64 bits
+enum TipoMensagem {
+    MSG_OLA = 1,        // [id]; o coordenador usa id = K
+    MSG_INICIAR = 2,    // [n, heuristica, tamanho do lote, inicial]
+    MSG_PASSO = 3,      // [limite de f]
+    MSG_RELATORIO = 4,  // resposta ao passo (CampoRelatorio)
+    MSG_LOTE = 5,       // [estado, pai, g] por filho
+    MSG_FIM_LOTE = 6,   // o remetente nao manda mais lotes neste passo
+    MSG_PAI = 7,        // [estado] -> [pai]
+    MSG_ENCERRAR = 8
+};
+
+enum CampoRelatorio {
+    REL_EXPANDIDOS,     // neste passo
+    REL_PENDENTES,      // abertos com f <= limite depois do passo
+    REL_MENOR_F,        // menor f aberto (NENHUM se nao ha abertos)
+    REL_MELHOR_G,       // melhor objetivo guardado (NENHUM se nenhum)
+    REL_MELHOR_ESTADO,
+    REL_ARMAZENADOS,    // os demais sao acumulados desde o inicio
+    REL_BYTES,
+    REL_MENSAGENS,
+    REL_BYTES_ENVIADOS,
+    REL_REABERTOS,
+    NUM_CAMPOS
+};
+
+struct Cabecalho {
+    uint32_t tipo;
+    uint32_t palavras;
+};
+
+// --- Estados empacotados ---
+
+uint64_t misturar(uint64_t x) {
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebULL;
+    x ^= x >> 31;
+    return x;
+}
+
+struct HashEstado {
+    size_t operator()(uint64_t x) const { return (size_t)misturar(x); }
+};
+
+// Hash independente do da tabela, para nao concentrar as chaves de um dono
+int donoDe(uint64_t estado, int k) { return (int)(misturar(estado ^ 0x9e3779b97f4a7c15ULL) % (uint64_t)k); }
+
+int vazioDe(uint64_t estado) { return (int)(estado >> BIT_VAZIO); }
+uint64_t mascaraDe(uint64_t estado) { return estado & ((1ULL << BIT_VAZIO) - 1); }
+
+uint64_t empacotar(const std::vector<char>& tabuleiro) {
+    uint64_t mascara = 0;
+    int vazio = 0, ficha = 0;
+    for (int i = 0; i < (int)tabuleiro.size(); ++i) {
+        if (tabuleiro[i] == '_') {
+            vazio = i;
+        } else {
+            if (tabuleiro[i] == 'B') mascara |= (1ULL << ficha);
+            ficha++;
+        }
+    }
+    return mascara | ((uint64_t)vazio << BIT_VAZIO);
+}
+
+void desempacotar(uint64_t estado, int n, std::vector<char>& tabuleiro) {
+    int vazio = vazioDe(estado);
+    tabuleiro.resize(2 * n + 1);
+    for (int i = 0, ficha = 0; i < 2 * n + 1; ++i) {
+        tabuleiro[i] = (i == vazio) ? '_' : (((estado >> ficha++) & 1ULL) ? 'B' : 'A');
+    }
+}
+
+// Um vazio e n fichas de cada cor, sem outros caracteres
+bool tabuleiroValido(const std::vector<char>& tabuleiro, int n) {
+    int vazios = 0, numA = 0, numB = 0;
+    for (char c : tabuleiro) {
+        if (c == '_') vazios++;
+        else if (c == 'A') numA++;
+        else if (c == 'B') numB++;
+        else return false;
+    }
+    return vazios == 1 && numA == n && numB == n;
+}
+
+// Mensagem de erro (vazia se a busca pode comecar)
+std::string validarEntrada(const std::vector<char>& inicial, int algoritmo, int trabalhadores) {
+    const int n = (int)(inicial.size() - 1) / 2;
+    if (algoritmo != 1 && algoritmo != 6) return "apenas BFS (1) e A* (6) sao distribuidos";
+    if (trabalhadores < 1) return "numero de trabalhadores invalido";
+    if (inicial.empty() || n < 1 || n > BuscaDistribuida::MAX_FICHAS || inicial.size() % 2 == 0 ||
+        !tabuleiroValido(inicial, n)) {
+        return "tabuleiro invalido: use um '_' e o mesmo numero (1 a " +
+               std::to_string(BuscaDistribuida::MAX_FICHAS) + ") de fichas 'A' e 'B'";
+    }
+    return "";
+}
+
+// Deslizar so move o vazio; pular troca a ordem de duas fichas vizinhas
+int vizinhos(uint64_t estado, int n, uint64_t destinos[4]) {
+    int vazio = vazioDe(estado);
+    uint64_t mascara = mascaraDe(estado);
+    int quantidade = 0;
+    const int alvos[4] = { vazio - 1, vazio + 1, vazio - 2, vazio + 2 };
+    for (int m = 0; m < 4; ++m) {
+        int novo = alvos[m];
+        if (novo < 0 || novo > 2 * n) continue;
+        uint64_t novaMascara = mascara;
+        int i = (novo == vazio - 2) ? vazio - 2 : (novo == vazio + 2) ? vazio : -1;
+        if (i >= 0 && (((mascara >> i) ^ (mascara >> (i + 1))) & 1ULL)) novaMascara ^= (3ULL << i);
+        destinos[quantidade++] = novaMascara | ((uint64_t)novo << BIT_VAZIO);
+    }
+    return quantidade;
+}
+
+// --- Sockets ---
+
+bool separarEndereco(const std::string& endereco, std::string& tipo, std::string& local, std::string& porta) {
+    size_t p = endereco.find(':');
+    if (p == std::string::npos) return false;
+    tipo = endereco.substr(0, p);
+    local = endereco.substr(p + 1);
+    porta.clear();
+    if (tipo == "unix") return !local.empty();
+    if (tipo != "tcp") return false;
+    size_t q = local.rfind(':');
+    if (q == std::string::npos) return false;
+    porta = local.substr(q + 1);
+    local = local.substr(0, q);
+    return !local.empty() && !porta.empty();
+}
+
+// Cria o socket ja conectado (conectar) ou escutando (escutar); -1 em erro
+int abrirSocket(const std::string& endereco, bool escutar, std::string& erro) {
+    std::string tipo, local, porta;
+    if (!separarEndereco(endereco, tipo, local, porta)) {
+        erro = "endereco invalido: " + endereco;
+        return -1;
+    }
+    if (tipo == "unix") {
+        sockaddr_un sa;
+        std::memset(&sa, 0, sizeof(sa));
+        if (local.size() >= sizeof(sa.sun_path)) {
+            erro = "caminho longo demais: " + local;
+            return -1;
+        }
+        sa.sun_family = AF_UNIX;
+        std::strcpy(sa.sun_path, local.c_str());
+        int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (fd < 0) {
+            erro = std::string("socket: ") + std::strerror(errno);
+            return -1;
+        }
+        if (escutar) unlink(local.c_str());
+        int r = escutar ? bind(fd, (sockaddr*)&sa, sizeof(sa)) : connect(fd, (sockaddr*)&sa, sizeof(sa));
+        if (r == 0 && escutar) r = listen(fd, 64);
+        if (r != 0) {
+            erro = endereco + ": " + std::strerror(errno);
+            close(fd);
+            return -1;
+        }
+        return fd;
+    }
+
+    addrinfo dicas;
+    std::memset(&dicas, 0, sizeof(dicas));
+    dicas.ai_family = AF_UNSPEC;
+    dicas.ai_socktype = SOCK_STREAM;
+    if (escutar) dicas.ai_flags = AI_PASSIVE;
+    addrinfo* lista = 0;
+    int r = getaddrinfo(local.c_str(), porta.c_str(), &dicas, &lista);
+    if (r != 0) {
+        erro = endereco + ": " + gai_strerror(r);
+        return -1;
+    }
+    int fd = -1;
+    for (addrinfo* a = lista; a && fd < 0; a = a->ai_next) {
+        fd = socket(a->ai_family, a->ai_socktype, a->ai_protocol);
+        if (fd < 0) continue;
+        int sim = 1;
+        if (escutar) setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &sim, sizeof(sim));
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &sim, sizeof(sim));
+        r = escutar ? bind(fd, a->ai_addr, a->ai_addrlen) : connect(fd, a->ai_addr, a->ai_addrlen);
+        if (r == 0 && escutar) r = listen(fd, 64);
+        if (r != 0) {
+            erro = endereco + ": " + std::strerror(errno);
+            close(fd);
+            fd = -1;
+        }
+    }
+    freeaddrinfo(lista);
+    return fd;
+}
+
+// O outro lado pode ainda nao estar escutando: tenta ate 'espera' segundos
+int conectar(const std::string& endereco, double espera, std::string& erro) {
+    std::chrono::steady_clock::time_point inicio = std::chrono::steady_clock::now();
+    for (;;) {
+        int fd = abrirSocket(endereco, false, erro);
+        if (fd >= 0) {
+            erro.clear();
+            return fd;
+        }
+        if (std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count() > espera) return -1;
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    }
+}
+
+bool enviarTudo(int fd, const char* dados, size_t tamanho) {
+    while (tamanho > 0) {
+        ssize_t r = send(fd, dados, tamanho, 0);
+        if (r < 0 && errno == EINTR) continue;
+        if (r <= 0) return false;
+        dados += r;
+        tamanho -= (size_t)r;
+    }
+    return true;
+}
+
+bool receberTudo(int fd, char* dados, size_t tamanho) {
+    while (tamanho > 0) {
+        ssize_t r = recv(fd, dados, tamanho, 0);
+        if (r < 0 && errno == EINTR) continue;
+        if (r <= 0) return false;
+        dados += r;
+        tamanho -= (size_t)r;
+    }
+    return true;
+}
+
+void anexarMensagem(std::string& buffer, uint32_t tipo, const uint64_t* palavras, size_t quantidade) {
+    Cabecalho cabecalho = { tipo, (uint32_t)quantidade };
+    buffer.append((const char*)&cabecalho, sizeof(cabecalho));
+    if (quantidade > 0) buffer.append((const char*)palavras, quantidade * sizeof(uint64_t));
+}
+
+bool enviarMensagem(int fd, uint32_t tipo, const std::vector<uint64_t>& palavras) {
+    std::string buffer;
+    anexarMensagem(buffer, tipo, palavras.empty() ? 0 : &palavras[0], palavras.size());
+    return enviarTudo(fd, buffer.data(), buffer.size());
+}
+
+bool receberMensagem(int fd, uint32_t& tipo, std::vector<uint64_t>& palavras) {
+    Cabecalho cabecalho;
+    if (!receberTudo(fd, (char*)&cabecalho, sizeof(cabecalho))) return false;
+    tipo = cabecalho.tipo;
+    palavras.resize(cabecalho.palavras);
+    return cabecalho.palavras == 0 ||
+           receberTudo(fd, (char*)&palavras[0], cabecalho.palavras * sizeof(uint64_t));
+}
+
+// --- Trabalhador ---
+
+struct Registro {
+    uint64_t pai;
+    int32_t g;
+    int16_t h;
+    uint8_t fechado;
+};
+
+class Trabalhador {
+public:
+    Trabalhador(int id, const std::vector<std::string>& enderecos)
+        : id(id), k((int)enderecos.size()), enderecos(enderecos), coordenador(-1), conexoes(enderecos.size()),
+          n(0), heuristica(0), tamanhoLote(1), melhorG(NENHUM), melhorEstado(NENHUM), mensagens(0),
+          bytesEnviados(0), reabertos(0) {}
+
+    ~Trabalhador() {
+        for (size_t j = 0; j < conexoes.size(); ++j) {
+            if (conexoes[j].fd >= 0) close(conexoes[j].fd);
+        }
+        if (coordenador >= 0) close(coordenador);
+    }
+
+    int executar(double espera);
+
+private:
+    struct Conexao {
+        Conexao() : fd(-1), enviado(0), lido(0), terminou(false) {}
+        int fd;
+        std::string saida;   // mensagens ainda nao enviadas a partir de 'enviado'
+        size_t enviado;
+        std::string entrada; // bytes recebidos, processados ate 'lido'
+        size_t lido;
+        bool terminou;       // recebeu MSG_FIM_LOTE neste passo
+    };
+
+    bool conectarTodos(double espera, std::string& erro);
+    void iniciar(const std::vector<uint64_t>& palavras);
+    bool passo(int limite, std::vector<uint64_t>& relatorio);
+    void integrar(uint64_t estado, uint64_t pai, int g);
+    void despacharLote(int destino);
+    bool bombear(int esperaMs);
+    bool tratarEntrada(int origem);
+    bool pendente() const;
+
+    int calcularH(uint64_t estado) {
+        if (heuristica == 0) return 0;
+        desempacotar(estado, n, rascunho);
+        return Solver::heuristica(rascunho, heuristica);
+    }
+
+    int id;
+    int k;
+    std::vector<std::string> enderecos;
+    int coordenador;
+    std::vector<Conexao> conexoes;
+
+    int n;
+    int heuristica; // 0 = BFS
+    size_t tamanhoLote;
+    MapaPlano<uint64_t, Registro, HashEstado> tabela;
+    std::vector<std::vector<uint64_t> > abertos; // baldes por f (podem ter entradas velhas)
+    std::vector<std::vector<uint64_t> > lotes;   // filhos a caminho de cada dono
+    std::vector<char> rascunho;
+    uint64_t melhorG;
+    uint64_t melhorEstado;
+    long long mensagens;
+    long long bytesEnviados;
+    long long reabertos;
+};
+
+// Escuta no proprio endereco, conecta nos de id menor e aceita os de id
+// maior e o coordenador (connect termina assim que o outro lado faz listen)
+bool Trabalhador::conectarTodos(double espera, std::string& erro) {
+    int ouvinte = abrirSocket(enderecos[id], true, erro);
+    if (ouvinte < 0) return false;
+    std::vector<uint64_t> ola(1, (uint64_t)id);
+    for (int j = 0; j < id; ++j) {
+        conexoes[j].fd = conectar(enderecos[j], espera, erro);
+        if (conexoes[j].fd < 0 || !enviarMensagem(conexoes[j].fd, MSG_OLA, ola)) {
+            close(ouvinte);
+            return false;
+        }
+    }
+    int faltam = k - id; // os de id maior e o coordenador
+    while (faltam > 0) {
+        int fd = accept(ouvinte, 0, 0);
+        if (fd < 0) {
+            if (errno == EINTR) continue;
+            erro = std::string("accept: ") + std::strerror(errno);
+            break;
+        }
+        uint32_t tipo;
+        std::vector<uint64_t> palavras;
+        if (!receberMensagem(fd, tipo, palavras) || tipo != MSG_OLA || palavras.size() != 1) {
+            close(fd);
+            continue;
+        }
+        int outro = (int)palavras[0];
+        if (outro == k && coordenador < 0) {
+            coordenador = fd;
+        } else if (outro > id && outro < k && conexoes[outro].fd < 0) {
+            conexoes[outro].fd = fd;
+        } else {
+            close(fd);
+            continue;
+        }
+        faltam--;
+    }
+    close(ouvinte);
+    std::string tipo, local, porta;
+    if (separarEndereco(enderecos[id], tipo, local, porta) && tipo == "unix") unlink(local.c_str());
+    if (faltam > 0) return false;
+
+    // Os lotes entre trabalhadores andam sem bloquear (ver bombear)
+    for (int j = 0; j < k; ++j) {
+        if (j == id) continue;
+        int sim = 1;
+        setsockopt(conexoes[j].fd, IPPROTO_TCP, TCP_NODELAY, &sim, sizeof(sim));
+        fcntl(conexoes[j].fd, F_SETFL, fcntl(conexoes[j].fd, F_GETFL) | O_NONBLOCK);
+    }
+    return true;
+}
+
+void Trabalhador::iniciar(const std::vector<uint64_t>& palavras) {
+    n = (int)palavras[0];
+    heuristica = (int)palavras[1];
+    tamanhoLote = std::max<uint64_t>(1, palavras[2]);
+    tabela.clear();
+    abertos.clear();
+    lotes.assign(k, std::vector<uint64_t>());
+    melhorG = NENHUM;
+    melhorEstado = NENHUM;
+    if (donoDe(palavras[3], k) == id) integrar(palavras[3], NENHUM, 0);
+}
+
+void Trabalhador::integrar(uint64_t estado, uint64_t pai, int g) {
+    Registro* r = tabela.procurar(estado);
+    if (r) {
+        if (g >= r->g) return;
+        r->g = g;
+        r->pai = pai;
+        if (r->fechado && mascaraDe(estado) != (1ULL << n) - 1) {
+            r->fechado = 0;
+            reabertos++;
+        }
+    } else {
+        Registro novo = { pai, g, (int16_t)calcularH(estado), 0 };
+        r = tabela.inserir(estado, novo).first;
+    }
+    // Objetivos nao sao expandidos: basta o melhor g de cada um
+    if (mascaraDe(estado) == (1ULL << n) - 1) {
+        r->fechado = 1;
+        if ((uint64_t)g < melhorG) {
+            melhorG = (uint64_t)g;
+            melhorEstado = estado;
+        }
+        return;
+    }
+    size_t f = (size_t)(r->g + r->h);
+    if (f >= abertos.size()) abertos.resize(f + 1);
+    abertos[f].push_back(estado);
+}
+
+void Trabalhador::despacharLote(int destino) {
+    std::vector<uint64_t>& lote = lotes[destino];
+    if (lote.empty()) return;
+    anexarMensagem(conexoes[destino].saida, MSG_LOTE, &lote[0], lote.size());
+    mensagens++;
+    bytesEnviados += (long long)(sizeof(Cabecalho) + lote.size() * sizeof(uint64_t));
+    lote.clear();
+}
+
+bool Trabalhador::pendente() const {
+    for (int j = 0; j < k; ++j) {
+        if (j == id) continue;
+        if (conexoes[j].enviado < conexoes[j].saida.size() || !conexoes[j].terminou) return true;
+    }
+    return false;
+}
+
+// Envia o que couber e processa o que chegou, sem bloquear em nenhum
+// socket: todos continuam lendo enquanto esperam para escrever
+bool Trabalhador::bombear(int esperaMs) {
+    std::vector<pollfd> fds;
+    std::vector<int> donos;
+    for (int j = 0; j < k; ++j) {
+        if (j == id) continue;
+        pollfd p;
+        p.fd = conexoes[j].fd;
+        p.events = POLLIN;
+        if (conexoes[j].enviado < conexoes[j].saida.size()) p.events |= POLLOUT;
+        p.revents = 0;
+        fds.push_back(p);
+        donos.push_back(j);
+    }
+    if (fds.empty()) return true;
+    int r = poll(&fds[0], fds.size(), esperaMs);
+    if (r < 0) return errno == EINTR;
+
+    char bloco[1 << 16];
+    for (size_t i = 0; i < fds.size(); ++i) {
+        Conexao& c = conexoes[donos[i]];
+        if (fds[i].revents & (POLLIN | POLLHUP | POLLERR)) {
+            for (;;) {
+                ssize_t lidos = recv(c.fd, bloco, sizeof(bloco), 0);
+                if (lidos > 0) {
+                    c.entrada.append(bloco, (size_t)lidos);
+                    continue;
+                }
+                if (lidos < 0 && errno == EINTR) continue;
+                if (lidos < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) break;
+                return false; // o outro trabalhador saiu no meio da busca
+            }
+            if (!tratarEntrada(donos[i])) return false;
+        }
+        if (fds[i].revents & POLLOUT) {
+            while (c.enviado < c.saida.size()) {
+                ssize_t enviados = send(c.fd, c.saida.data() + c.enviado, c.saida.size() - c.enviado, 0);
+                if (enviados > 0) {
+                    c.enviado += (size_t)enviados;
+                    continue;
+                }
+                if (enviados < 0 && errno == EINTR) continue;
+                if (enviados < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) break;
+                return false;
+            }
+            if (c.enviado == c.saida.size()) {
+                c.saida.clear();
+                c.enviado = 0;
+            }
+        }
+    }
+    return true;
+}
+
+bool Trabalhador::tratarEntrada(int origem) {
+    Conexao& c = conexoes[origem];
+    while (c.entrada.size() - c.lido >= sizeof(Cabecalho)) {
+        Cabecalho cabecalho;
+        std::memcpy(&cabecalho, c.entrada.data() + c.lido, sizeof(cabecalho));
+        size_t tamanho = sizeof(cabecalho) + (size_t)cabecalho.palavras * sizeof(uint64_t);
+        if (c.entrada.size() - c.lido < tamanho) break;
+        const char* dados = c.entrada.data() + c.lido + sizeof(cabecalho);
+        if (cabecalho.tipo == MSG_LOTE) {
+            for (uint32_t i = 0; i + 3 <= cabecalho.palavras; i += 3) {
+                uint64_t filho[3];
+                std::memcpy(filho, dados + i * sizeof(uint64_t), sizeof(filho));
+                integrar(filho[0], filho[1], (int)filho[2]);
+            }
+        } else if (cabecalho.tipo == MSG_FIM_LOTE) {
+            c.terminou = true;
+        } else {
+            return false;
+        }
+        c.lido += tamanho;
+    }
+    if (c.lido == c.entrada.size()) {
+        c.entrada.clear();
+        c.lido = 0;
+    } else if (c.lido > (1 << 20)) {
+        c.entrada.erase(0, c.lido);
+        c.lido = 0;
+    }
+    return true;
+}
+
+bool Trabalhador::passo(int limite, std::vector<uint64_t>& relatorio) {
+    // Os abertos dentro do limite saem dos baldes antes de expandir: filhos
+    // que caem dentro do limite ficam para o proximo passo
+    std::vector<uint64_t> fila;
+    for (int f = 0; f <= limite && f < (int)abertos.size(); ++f) {
+        fila.insert(fila.end(), abertos[f].begin(), abertos[f].end());
+        std::vector<uint64_t>().swap(abertos[f]);
+    }
+
+    long long expandidos = 0;
+    uint64_t destinos[4];
+    for (size_t i = 0; i < fila.size(); ++i) {
+        uint64_t estado = fila[i];
+        Registro* r = tabela.procurar(estado);
+        if (!r || r->fechado || r->g + r->h > limite) continue; // entrada velha
+        r->fechado = 1;
+        int g = r->g;
+        uint64_t pai = r->pai;
+        expandidos++;
+        int quantidade = vizinhos(estado, n, destinos);
+        for (int m = 0; m < quantidade; ++m) {
+            if (destinos[m] == pai) continue;
+            int dono = donoDe(destinos[m], k);
+            if (dono == id) {
+                integrar(destinos[m], estado, g + 1);
+                continue;
+            }
+            std::vector<uint64_t>& lote = lotes[dono];
+            lote.push_back(destinos[m]);
+            lote.push_back(estado);
+            lote.push_back((uint64_t)(g + 1));
+            if (lote.size() >= 3 * tamanhoLote) {
+                despacharLote(dono);
+                if (!bombear(0)) return false;
+            }
+        }
+    }
+    for (int j = 0; j < k; ++j) {
+        if (j == id) continue;
+        despacharLote(j);
+        anexarMensagem(conexoes[j].saida, MSG_FIM_LOTE, 0, 0);
+    }
+    while (pendente()) {
+        if (!bombear(1000)) return false;
+    }
+    for (int j = 0; j < k; ++j) conexoes[j].terminou = false;
+
+    uint64_t pendentes = 0, menorF = NENHUM, bytes = 0;
+    for (size_t f = 0; f < abertos.size(); ++f) {
+        if ((int)f <= limite) pendentes += abertos[f].size();
+        else if (menorF == NENHUM && !abertos[f].empty()) menorF = f;
+        bytes += abertos[f].capacity() * sizeof(uint64_t);
+    }
+    if (pendentes > 0) menorF = (uint64_t)limite;
+    bytes += tabela.capacidade() * (sizeof(uint64_t) + sizeof(Registro) + 2);
+
+    relatorio.assign(NUM_CAMPOS, 0);
+    relatorio[REL_EXPANDIDOS] = (uint64_t)expandidos;
+    relatorio[REL_PENDENTES] = pendentes;
+    relatorio[REL_MENOR_F] = menorF;
+    relatorio[REL_MELHOR_G] = melhorG;
+    relatorio[REL_MELHOR_ESTADO] = melhorEstado;
+    relatorio[REL_ARMAZENADOS] = tabela.size();
+    relatorio[REL_BYTES] = bytes;
+    relatorio[REL_MENSAGENS] = (uint64_t)mensagens;
+    relatorio[REL_BYTES_ENVIADOS] = (uint64_t)bytesEnviados;
+    relatorio[REL_REABERTOS] = (uint64_t)reabertos;
+    return true;
+}
+
+int Trabalhador::executar(double espera) {
+    std::string erro;
+    if (!conectarTodos(espera, erro)) {
+        std::cerr << "Trabalhador " << id << ": " << (erro.empty() ? "falha ao conectar" : erro) << "\n";
+        return 1;
+    }
+    uint32_t tipo;
+    std::vector<uint64_t> palavras, resposta;
+    while (receberMensagem(coordenador, tipo, palavras)) {
+        if (tipo == MSG_INICIAR && palavras.size() == 4) {
+            iniciar(palavras);
+        } else if (tipo == MSG_PASSO && palavras.size() == 1) {
+            if (!passo((int)palavras[0], resposta)) {
+                std::cerr << "Trabalhador " << id << ": conexao perdida durante a troca de lotes\n";
+                return 1;
+            }
+            if (!enviarMensagem(coordenador, MSG_RELATORIO, resposta)) return 1;
+        } else if (tipo == MSG_PAI && palavras.size() == 1) {
+            const Registro* r = tabela.procurar(palavras[0]);
+            if (!enviarMensagem(coordenador, MSG_PAI, std::vector<uint64_t>(1, r ? r->pai : NENHUM))) return 1;
+        } else if (tipo == MSG_ENCERRAR) {
+            return 0;
+        } else {
+            return 1;
+        }
+    }
+    return 1;
+}
+
+} // namespace
+
+std::vector<std::string> BuscaDistribuida::enderecosLocais(const OpcoesDistribuidas& opcoes) {
+    std::vector<std::string> enderecos;
+    for (int i = 0; i < opcoes.trabalhadores; ++i) {
+        if (opcoes.transporte == "tcp") {
+            enderecos.push_back("tcp:127.0.0.1:" + std::to_string(opcoes.porta + i));
+        } else {
+            enderecos.push_back("unix:/tmp/regua_distribuido_" + std::to_string((long long)getpid()) + "_" +
+                                std::to_string(i) + ".sock");
+        }
+    }
+    return enderecos;
+}
+
+int BuscaDistribuida::executarTrabalhador(int id, const std::vector<std::string>& enderecos, double esperaConexao) {
+    if (id < 0 || id >= (int)enderecos.size()) return 1;
+    signal(SIGPIPE, SIG_IGN);
+    Trabalhador trabalhador(id, enderecos);
+    return trabalhador.executar(esperaConexao);
+}
+
+ResultadoDistribuido BuscaDistribuida::coordenar(const std::vector<char>& inicial, int algoritmo, int heuristica,
+                                                 const std::vector<std::string>& enderecos,
+                                                 const OpcoesDistribuidas& opcoes) {
+    ResultadoDistribuido resultado;
+    resultado.stats.profundidade = -1;
+    const int k = (int)enderecos.size();
+    const int n = (int)(inicial.size() - 1) / 2;
+    resultado.erro = validarEntrada(inicial, algoritmo, k);
+    if (!resultado.erro.empty()) return resultado;
+    signal(SIGPIPE, SIG_IGN);
+    auto inicio = std::chrono::high_resolution_clock::now();
+
+    std::vector<int> fds(k, -1);
+    std::vector<uint64_t> ola(1, (uint64_t)k);
+    for (int i = 0; i < k && resultado.erro.empty(); ++i) {
+        fds[i] = conectar(enderecos[i], opcoes.espera_conexao, resultado.erro);
+        if (fds[i] >= 0 && !enviarMensagem(fds[i], MSG_OLA, ola)) resultado.erro = "falha no envio a " + enderecos[i];
+    }
+
+    // BFS e o A* com h = 0: cada rodada e uma camada
+    int h = algoritmo == 1 ? 0 : heuristica;
+    uint64_t estadoInicial = empacotar(inicial);
+    std::vector<uint64_t> palavras, relatorio;
+    palavras.push_back((uint64_t)n);
+    palavras.push_back((uint64_t)h);
+    palavras.push_back((uint64_t)std::max(1, opcoes.tamanho_lote));
+    palavras.push_back(estadoInicial);
+    for (int i = 0; i < k && resultado.erro.empty(); ++i) {
+        if (!enviarMensagem(fds[i], MSG_INICIAR, palavras)) resultado.erro = "falha no envio a " + enderecos[i];
+    }
+
+    uint64_t limite = h == 0 ? 0 : (uint64_t)Solver::heuristica(inicial, h);
+    uint64_t melhorG = NENHUM, melhorEstado = NENHUM;
+    std::vector<uint64_t> ultimos(k * NUM_CAMPOS, 0);
+    while (resultado.erro.empty()) {
+        resultado.rodadas++;
+        uint64_t pendentes, menorF;
+        do {
+            resultado.passos++;
+            pendentes = 0;
+            menorF = NENHUM;
+            for (int i = 0; i < k && resultado.erro.empty(); ++i) {
+                if (!enviarMensagem(fds[i], MSG_PASSO, std::vector<uint64_t>(1, limite))) {
+                    resultado.erro = "falha no envio a " + enderecos[i];
+                }
+            }
+            for (int i = 0; i < k && resultado.erro.empty(); ++i) {
+                uint32_t tipo;
+                if (!receberMensagem(fds[i], tipo, relatorio) || tipo != MSG_RELATORIO ||
+                    relatorio.size() != NUM_CAMPOS) {
+                    resultado.erro = "trabalhador " + std::to_string(i) + " nao respondeu ao passo";
+                    break;
+                }
+                resultado.stats.nos_expandidos += (long long)relatorio[REL_EXPANDIDOS];
+                pendentes += relatorio[REL_PENDENTES];
+                menorF = std::min(menorF, relatorio[REL_MENOR_F]);
+                if (relatorio[REL_MELHOR_G] < melhorG) {
+                    melhorG = relatorio[REL_MELHOR_G];
+                    melhorEstado = relatorio[REL_MELHOR_ESTADO];
+                }
+                std::copy(relatorio.begin(), relatorio.end(), ultimos.begin() + i * NUM_CAMPOS);
+            }
+        } while (resultado.erro.empty() && pendentes > 0);
+        // Todo aberto tem f > limite: o melhor objetivo e otimo se couber no proximo limite
+        if (menorF == NENHUM || melhorG <= menorF) break;
+        limite = menorF;
+    }
+
+    // Caminho: o dono de cada estado conhece o pai
+    std::vector<uint64_t> estados;
+    for (uint64_t e = melhorEstado; resultado.erro.empty() && e != NENHUM; ) {
+        estados.push_back(e);
+        int dono = donoDe(e, k);
+        uint32_t tipo;
+        if (!enviarMensagem(fds[dono], MSG_PAI, std::vector<uint64_t>(1, e)) ||
+            !receberMensagem(fds[dono], tipo, palavras) || tipo != MSG_PAI || palavras.size() != 1) {
+            resultado.erro = "trabalhador " + std::to_string(dono) + " nao respondeu ao pedido de pai";
+            break;
+        }
+        e = palavras[0];
+        if (estados.size() > (size_t)melhorG + 1) resultado.erro = "caminho inconsistente";
+    }
+    for (int i = 0; i < k; ++i) {
+        if (fds[i] < 0) continue;
+        enviarMensagem(fds[i], MSG_ENCERRAR, std::vector<uint64_t>());
+        close(fds[i]);
+    }
+
+    SolverStats& stats = resultado.stats;
+    for (int i = 0; i < k; ++i) {
+        const uint64_t* r = &ultimos[i * NUM_CAMPOS];
+        resultado.estados_por_trabalhador.push_back((long long)r[REL_ARMAZENADOS]);
+        resultado.bytes_por_trabalhador.push_back((long long)r[REL_BYTES]);
+        resultado.mensagens += (long long)r[REL_MENSAGENS];
+        resultado.bytes_enviados += (long long)r[REL_BYTES_ENVIADOS];
+        stats.nos_visitados += (long long)r[REL_ARMAZENADOS];
+        stats.nos_reabertos += (long long)r[REL_REABERTOS];
+    }
+    stats.pico_nos = stats.nos_visitados;
+    if (resultado.erro.empty() && melhorEstado != NENHUM) {
+        stats.caminho = CaminhoCompacto(vazioDe(estados.back()));
+        for (size_t i = estados.size() - 1; i-- > 0; ) stats.caminho.adicionar(vazioDe(estados[i]));
+        stats.profundidade = (int)stats.caminho.size();
+        stats.custo = stats.profundidade;
+    }
+    stats.fator_ramificacao = stats.nos_expandidos > 0 ? (double)stats.nos_visitados / stats.nos_expandidos : 0.0;
+    stats.tempo_execucao =
+        std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - inicio).count();
+    return resultado;
+}
+
+ResultadoDistribuido BuscaDistribuida::resolver(const std::vector<char>& inicial, int algoritmo, int heuristica,
+                                                const OpcoesDistribuidas& opcoes) {
+    ResultadoDistribuido resultado;
+    resultado.stats.profundidade = -1;
+    resultado.erro = validarEntrada(inicial, algoritmo, opcoes.trabalhadores);
+    if (!resultado.erro.empty()) return resultado;
+
+    std::vector<std::string> enderecos = enderecosLocais(opcoes);
+    std::vector<pid_t> filhos;
+    std::cout.flush();
+    std::cerr.flush();
+    for (int i = 0; i < opcoes.trabalhadores; ++i) {
+        pid_t pid = fork();
+        if (pid == 0) _exit(executarTrabalhador(i, enderecos, opcoes.espera_conexao));
+        if (pid < 0) break;
+        filhos.push_back(pid);
+    }
+
+    if ((int)filhos.size() == opcoes.trabalhadores) {
+        resultado = coordenar(inicial, algoritmo, heuristica, enderecos, opcoes);
+    } else {
+        resultado.erro = std::string("fork: ") + std::strerror(errno);
+    }
+    for (size_t i = 0; i < filhos.size(); ++i) {
+        if (!resultado.erro.empty()) kill(filhos[i], SIGTERM);
+        waitpid(filhos[i], 0, 0);
+    }
+    for (const std::string& endereco : enderecos) {
+        std::string tipo, local, porta;
+        if (separarEndereco(endereco, tipo, local, porta) && tipo == "unix") unlink(local.c_str());
+    }
+    return resultado;
+}
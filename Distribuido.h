@@ -0,0 +1,74 @@
+#ifndef DISTRIBUIDO_H
+#define DISTRIBUIDO_H
+
+#include <vector>
+#include <string>
+#include <cstdint>
+#include "Solver.h"
+
+// Busca em largura e A* distribuidas entre processos (POSIX).
+//
+// Cada um dos K trabalhadores e dono de uma particao do espaco de estados
+// (hash do estado mod K) e guarda so os seus estados: pai, g e h numa
+// MapaPlano e a lista aberta em baldes por f. Um estado cabe em 64 bits
+// (mascara das fichas 'B' nos bits 0..2n-1 e o vazio a partir do bit 58).
+//
+// A busca anda em rodadas com um limite de f. Em cada passo o coordenador
+// manda todos expandirem os abertos com f <= limite; os filhos vao em lotes
+// para os donos, direto entre trabalhadores, e cada trabalhador avisa os
+// outros quando terminou de mandar (fim de lote). Os passos se repetem ate
+// nenhum trabalhador ter abertos dentro do limite; o limite passa entao ao
+// menor f aberto. A busca termina quando o melhor objetivo encontrado cabe
+// no limite (na BFS, h = 0 e cada rodada e uma camada). O caminho e
+// remontado pelo coordenador perguntando o pai de cada estado ao seu dono.
+//
+// Os enderecos sao "unix:/caminho/do/socket" ou "tcp:host:porta", um por
+// trabalhador. Os processos so precisam alcancar esses enderecos, entao os
+// trabalhadores podem rodar em outras maquinas (mesma arquitetura: as
+// mensagens vao na ordem de bytes da maquina).
+//
+// Cada trabalhador escuta no seu endereco, conecta nos de id menor e aceita
+// os de id maior e o coordenador; as conexoes se identificam com o id logo
+// apos conectar.
+
+struct OpcoesDistribuidas {
+    int trabalhadores = 4;
+    std::string transporte = "unix"; // "unix" (sockets em /tmp) ou "tcp" (127.0.0.1)
+    int porta = 47000;               // tcp: o trabalhador i escuta em porta + i
+    int tamanho_lote = 4096;         // estados por mensagem entre trabalhadores
+    double espera_conexao = 10.0;    // s tentando conectar a um endereco
+};
+
+struct ResultadoDistribuido {
+    SolverStats stats;                          // caminho, profundidade, expandidos, tempo
+    std::vector<long long> estados_por_trabalhador;
+    std::vector<long long> bytes_por_trabalhador; // tabela + lista aberta no fim
+    long long mensagens = 0;                    // lotes trocados entre trabalhadores
+    long long bytes_enviados = 0;
+    int rodadas = 0;                            // limites de f usados
+    int passos = 0;                             // passos de expansao + troca
+    std::string erro;                           // vazio se a busca rodou
+};
+
+class BuscaDistribuida {
+public:
+    static const int MAX_FICHAS = 29;
+
+    // Enderecos locais para K trabalhadores com o transporte das opcoes
+    static std::vector<std::string> enderecosLocais(const OpcoesDistribuidas& opcoes);
+
+    // Roda um trabalhador ate o coordenador encerrar; retorna 0 ou 1 em erro
+    static int executarTrabalhador(int id, const std::vector<std::string>& enderecos, double esperaConexao);
+
+    // Coordena uma busca (algoritmo 1 = BFS, 6 = A*) com os trabalhadores
+    // ja rodando nos enderecos e os encerra no fim
+    static ResultadoDistribuido coordenar(const std::vector<char>& inicial, int algoritmo, int heuristica,
+                                          const std::vector<std::string>& enderecos,
+                                          const OpcoesDistribuidas& opcoes);
+
+    // Cria os trabalhadores nesta maquina (fork) e coordena a busca
+    static ResultadoDistribuido resolver(const std::vector<char>& inicial, int algoritmo, int heuristica,
+                                         const OpcoesDistribuidas& opcoes);
+};
+
+#endif
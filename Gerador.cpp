@@ -0,0 +1,380 @@
+#include "Gerador.h"
+#include <fstream>
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <thread>
+
+const uint8_t GeradorTabuleiros::DISTANCIA_DESCONHECIDA;
+
+GeradorTabuleiros::GeradorTabuleiros(int numFichas, uint64_t semente)
+    : n(numFichas), tamanho(2 * numFichas + 1), semente(semente), estado(semente),
+      combinacoes(0), total(0), proximoEstrato(0) {
+    if (n < 1 || n > MAX_FICHAS_POSTO) return;
+    binomial.assign(2 * n + 1, std::vector<uint64_t>(n + 1, 0));
+    for (int a = 0; a <= 2 * n; ++a) {
+        binomial[a][0] = 1;
+        for (int b = 1; b <= std::min(a, n); ++b) {
+            binomial[a][b] = binomial[a - 1][b - 1] + (b <= a - 1 ? binomial[a - 1][b] : 0);
+        }
+    }
+    combinacoes = binomial[2 * n][n];
+    total = combinacoes * (uint64_t)tamanho;
+}
+
+std::vector<char> GeradorTabuleiros::intercalado(int numFichas) {
+    std::vector<char> tabuleiro;
+    char atual = 'A';
+    for (int i = 0; i < 2 * numFichas + 1; ++i) {
+        if (i == numFichas) {
+            tabuleiro.push_back('_');
+        } else {
+            tabuleiro.push_back(atual);
+            atual = (atual == 'A') ? 'B' : 'A';
+        }
+    }
+    return tabuleiro;
+}
+
+std::vector<char> GeradorTabuleiros::invertido(int numFichas) {
+    std::vector<char> tabuleiro(numFichas, 'A');
+    tabuleiro.push_back('_');
+    tabuleiro.insert(tabuleiro.end(), numFichas, 'B');
+    return tabuleiro;
+}
+
+// splitmix64
+uint64_t GeradorTabuleiros::proximo() {
+    uint64_t z = (estado += 0x9e3779b97f4a7c15ULL);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+// Uniforme em [0, limite): descarta os valores abaixo de 2^64 mod limite
+uint64_t GeradorTabuleiros::abaixoDe(uint64_t limite) {
+    uint64_t limiar = (0 - limite) % limite;
+    uint64_t x;
+    do {
+        x = proximo();
+    } while (x < limiar);
+    return x % limite;
+}
+
+// Indice da combinacao: para cada ficha 'B' somam-se as combinacoes que teriam
+// um 'A' naquela ficha (com o mesmo prefixo), que vem antes na ordem lexicografica
+uint64_t GeradorTabuleiros::postoMascara(int vazio, uint64_t mascara) const {
+    uint64_t indice = 0;
+    int restantes = n;
+    for (int i = 0; i < 2 * n && restantes > 0; ++i) {
+        if ((mascara >> i) & 1ULL) {
+            indice += binomial[2 * n - i - 1][restantes];
+            restantes--;
+        }
+    }
+    return (uint64_t)vazio * combinacoes + indice;
+}
+
+void GeradorTabuleiros::despostoMascara(uint64_t p, int& vazio, uint64_t& mascara) const {
+    vazio = (int)(p / combinacoes);
+    uint64_t indice = p % combinacoes;
+    mascara = 0;
+    int restantes = n;
+    for (int i = 0; i < 2 * n && restantes > 0; ++i) {
+        uint64_t comA = binomial[2 * n - i - 1][restantes];
+        if (indice >= comA) {
+            indice -= comA;
+            mascara |= (1ULL << i);
+            restantes--;
+        }
+    }
+}
+
+uint64_t GeradorTabuleiros::posto(const std::vector<char>& tabuleiro) const {
+    if (total == 0) return 0;
+    int vazio = 0;
+    uint64_t mascara = 0;
+    int ficha = 0;
+    for (int i = 0; i < (int)tabuleiro.size(); ++i) {
+        if (tabuleiro[i] == '_') {
+            vazio = i;
+        } else {
+            if (tabuleiro[i] == 'B') mascara |= (1ULL << ficha);
+            ficha++;
+        }
+    }
+    return postoMascara(vazio, mascara);
+}
+
+void GeradorTabuleiros::desposto(uint64_t p, std::vector<char>& tabuleiro) const {
+    if (total == 0) return;
+    int vazio;
+    uint64_t mascara;
+    despostoMascara(p, vazio, mascara);
+    tabuleiro.resize(tamanho);
+    int ficha = 0;
+    for (int i = 0; i < tamanho; ++i) {
+        if (i == vazio) {
+            tabuleiro[i] = '_';
+        } else {
+            tabuleiro[i] = ((mascara >> ficha) & 1ULL) ? 'B' : 'A';
+            ficha++;
+        }
+    }
+}
+
+void GeradorTabuleiros::sortear(std::vector<char>& tabuleiro) {
+    if (total > 0) {
+        desposto(abaixoDe(total), tabuleiro);
+        return;
+    }
+    // Total fora de 64 bits: vazio uniforme e fichas embaralhadas (Fisher-Yates)
+    int vazio = (int)abaixoDe((uint64_t)tamanho);
+    std::vector<char> fichas(2 * n, 'A');
+    std::fill(fichas.begin() + n, fichas.end(), 'B');
+    for (int i = 2 * n - 1; i > 0; --i) {
+        std::swap(fichas[i], fichas[abaixoDe((uint64_t)i + 1)]);
+    }
+    tabuleiro.resize(tamanho);
+    for (int i = 0, ficha = 0; i < tamanho; ++i) {
+        tabuleiro[i] = (i == vazio) ? '_' : fichas[ficha++];
+    }
+}
+
+std::vector<char> GeradorTabuleiros::sortear() {
+    std::vector<char> tabuleiro;
+    sortear(tabuleiro);
+    return tabuleiro;
+}
+
+// Busca em largura a partir de todos os objetivos (o vazio pode estar em qualquer
+// lugar). Os movimentos sao reversiveis, entao a distancia vale nos dois sentidos.
+// Deslizar so move o vazio; pular troca a ordem de duas fichas vizinhas.
+bool GeradorTabuleiros::prepararDistancias() {
+    if (!inicioEstrato.empty()) return true;
+    if (n < 1 || n > MAX_FICHAS_DISTANCIAS) return false;
+
+    std::vector<uint8_t> distancia(total, DISTANCIA_DESCONHECIDA);
+    std::vector<uint32_t> fila;
+    fila.reserve(total);
+    uint64_t objetivo = (1ULL << n) - 1;
+    for (int v = 0; v < tamanho; ++v) {
+        uint32_t p = (uint32_t)postoMascara(v, objetivo);
+        distancia[p] = 0;
+        fila.push_back(p);
+    }
+    uint64_t destinos[4];
+    for (size_t k = 0; k < fila.size(); ++k) {
+        int vazio;
+        uint64_t mascara;
+        despostoMascara(fila[k], vazio, mascara);
+        uint8_t d = distancia[fila[k]];
+        int quantidade = vizinhos(vazio, mascara, destinos);
+        for (int m = 0; m < quantidade; ++m) {
+            uint64_t p = destinos[m];
+            if (distancia[p] == DISTANCIA_DESCONHECIDA) {
+                distancia[p] = (uint8_t)(d + 1);
+                fila.push_back((uint32_t)p);
+            }
+        }
+    }
+
+    // A fila da BFS ja esta ordenada por distancia
+    int maxima = distancia[fila.back()];
+    inicioEstrato.assign(maxima + 2, 0);
+    for (size_t k = 0; k < fila.size(); ++k) inicioEstrato[distancia[fila[k]] + 1]++;
+    for (int d = 1; d <= maxima + 1; ++d) inicioEstrato[d] += inicioEstrato[d - 1];
+    porDistancia.swap(fila);
+    proximoEstrato = 0;
+    return true;
+}
+
+int GeradorTabuleiros::vizinhos(int vazio, uint64_t mascara, uint64_t destinos[4]) const {
+    int quantidade = 0;
+    const int alvos[4] = { vazio - 1, vazio + 1, vazio - 2, vazio + 2 };
+    for (int m = 0; m < 4; ++m) {
+        int novo = alvos[m];
+        if (novo < 0 || novo >= tamanho) continue;
+        uint64_t novaMascara = mascara;
+        int i = (novo == vazio - 2) ? vazio - 2 : (novo == vazio + 2) ? vazio : -1;
+        if (i >= 0 && (((mascara >> i) ^ (mascara >> (i + 1))) & 1ULL)) novaMascara ^= (3ULL << i);
+        destinos[quantidade++] = postoMascara(novo, novaMascara);
+    }
+    return quantidade;
+}
+
+// Camada a camada: as threads pegam blocos da fronteira por um contador atomico
+// e so quem troca DISTANCIA_DESCONHECIDA por d + 1 poe o vizinho na proxima
+// fronteira, entao cada tabuleiro e expandido uma unica vez.
+bool GeradorTabuleiros::buscaEmLarguraParalela(const std::vector<uint64_t>& origens,
+                                               std::vector<uint8_t>& distancia, int threads) const {
+    if (n < 1 || n > MAX_FICHAS_DISTANCIAS_EXATAS) return false;
+    if (threads < 1) threads = 1;
+    const size_t BLOCO = 4096;
+
+    std::unique_ptr<std::atomic<uint8_t>[]> marca(new std::atomic<uint8_t>[total]);
+    for (uint64_t p = 0; p < total; ++p) marca[p].store(DISTANCIA_DESCONHECIDA, std::memory_order_relaxed);
+    std::vector<uint32_t> fronteira;
+    for (uint64_t p : origens) {
+        if (marca[p].exchange(0, std::memory_order_relaxed) != 0) fronteira.push_back((uint32_t)p);
+    }
+
+    std::vector<std::vector<uint32_t> > proximas(threads);
+    for (int d = 0; !fronteira.empty(); ++d) {
+        if (d + 1 >= DISTANCIA_DESCONHECIDA) return false;
+        const uint8_t seguinte = (uint8_t)(d + 1);
+        std::atomic<size_t> proximoBloco(0);
+        auto expandir = [&](int id) {
+            std::vector<uint32_t>& novos = proximas[id];
+            novos.clear();
+            uint64_t destinos[4];
+            for (;;) {
+                size_t inicio = proximoBloco.fetch_add(BLOCO);
+                if (inicio >= fronteira.size()) break;
+                size_t fim = std::min(fronteira.size(), inicio + BLOCO);
+                for (size_t k = inicio; k < fim; ++k) {
+                    int vazio;
+                    uint64_t mascara;
+                    despostoMascara(fronteira[k], vazio, mascara);
+                    int quantidade = vizinhos(vazio, mascara, destinos);
+                    for (int m = 0; m < quantidade; ++m) {
+                        std::atomic<uint8_t>& alvo = marca[destinos[m]];
+                        uint8_t esperado = DISTANCIA_DESCONHECIDA;
+                        if (alvo.load(std::memory_order_relaxed) == DISTANCIA_DESCONHECIDA &&
+                            alvo.compare_exchange_strong(esperado, seguinte, std::memory_order_relaxed)) {
+                            novos.push_back((uint32_t)destinos[m]);
+                        }
+                    }
+                }
+            }
+        };
+        // Fronteiras pequenas nao compensam criar threads
+        int usadas = (int)std::min<size_t>((size_t)threads, (fronteira.size() + BLOCO - 1) / BLOCO);
+        std::vector<std::thread> ajudantes;
+        for (int t = 1; t < usadas; ++t) ajudantes.push_back(std::thread(expandir, t));
+        expandir(0);
+        for (std::thread& t : ajudantes) t.join();
+
+        fronteira.clear();
+        for (int t = 0; t < usadas; ++t) fronteira.insert(fronteira.end(), proximas[t].begin(), proximas[t].end());
+    }
+
+    distancia.resize(total);
+    for (uint64_t p = 0; p < total; ++p) distancia[p] = marca[p].load(std::memory_order_relaxed);
+    return true;
+}
+
+bool GeradorTabuleiros::distanciasAoObjetivo(std::vector<uint8_t>& distancia, int threads) const {
+    if (n < 1 || n > MAX_FICHAS_DISTANCIAS_EXATAS) return false;
+    std::vector<uint64_t> objetivos;
+    uint64_t objetivo = (1ULL << n) - 1;
+    for (int v = 0; v < tamanho; ++v) objetivos.push_back(postoMascara(v, objetivo));
+    return buscaEmLarguraParalela(objetivos, distancia, threads);
+}
+
+bool GeradorTabuleiros::distanciasDe(const std::vector<char>& tabuleiro, std::vector<uint8_t>& distancia,
+                                     int threads) const {
+    if (n < 1 || n > MAX_FICHAS_DISTANCIAS_EXATAS || (int)tabuleiro.size() != tamanho) return false;
+    return buscaEmLarguraParalela(std::vector<uint64_t>(1, posto(tabuleiro)), distancia, threads);
+}
+
+uint64_t GeradorTabuleiros::quantidadeComDistancia(int d) const {
+    if (d < 0 || d > distanciaMaxima()) return 0;
+    return inicioEstrato[d + 1] - inicioEstrato[d];
+}
+
+bool GeradorTabuleiros::sortearComDistancia(int d, std::vector<char>& tabuleiro) {
+    uint64_t quantidade = quantidadeComDistancia(d);
+    if (quantidade == 0) return false;
+    desposto(porDistancia[inicioEstrato[d] + abaixoDe(quantidade)], tabuleiro);
+    return true;
+}
+
+bool GeradorTabuleiros::sortearEstratificado(std::vector<char>& tabuleiro) {
+    if (distanciaMaxima() < 0) return false;
+    int d = proximoEstrato;
+    proximoEstrato = (proximoEstrato + 1) % (distanciaMaxima() + 1);
+    return sortearComDistancia(d, tabuleiro);
+}
+
+static void anexarLittleEndian(std::string& buffer, uint64_t valor, int bytes) {
+    for (int i = 0; i < bytes; ++i) buffer += (char)((valor >> (8 * i)) & 0xff);
+}
+
+long long GeradorTabuleiros::gravarLote(const std::string& arquivo, long long quantidade, FormatoLote formato,
+                                        bool estratificado) {
+    const size_t TAMANHO_BUFFER = 1 << 16;
+    if (quantidade < 0 || n < 1) return -1;
+    if (estratificado && !prepararDistancias()) return -1;
+    std::ofstream saida(arquivo.c_str(), std::ios::out | std::ios::trunc | std::ios::binary);
+    if (!saida) return -1;
+
+    std::string buffer;
+    buffer.reserve(TAMANHO_BUFFER + 4096);
+    if (formato == LOTE_BINARIO) {
+        buffer += "RGP1";
+        anexarLittleEndian(buffer, (uint64_t)n, 4);
+        anexarLittleEndian(buffer, (uint64_t)quantidade, 8);
+        anexarLittleEndian(buffer, semente, 8);
+    }
+
+    std::vector<char> tabuleiro;
+    std::vector<uint8_t> mascaraBytes((2 * n + 7) / 8);
+    for (long long k = 0; k < quantidade; ++k) {
+        // Com posto de 64 bits o registro sai direto do vazio + mascara
+        int vazio = 0;
+        uint64_t mascara = 0;
+        bool porMascara = total > 0;
+        if (porMascara) {
+            uint64_t p;
+            if (estratificado) {
+                int d = proximoEstrato;
+                proximoEstrato = (proximoEstrato + 1) % (distanciaMaxima() + 1);
+                p = porDistancia[inicioEstrato[d] + abaixoDe(quantidadeComDistancia(d))];
+            } else {
+                p = abaixoDe(total);
+            }
+            despostoMascara(p, vazio, mascara);
+        } else {
+            sortear(tabuleiro);
+        }
+
+        if (formato == LOTE_BINARIO) {
+            std::fill(mascaraBytes.begin(), mascaraBytes.end(), 0);
+            if (porMascara) {
+                for (size_t b = 0; b < mascaraBytes.size(); ++b) mascaraBytes[b] = (uint8_t)(mascara >> (8 * b));
+            } else {
+                for (int i = 0, ficha = 0; i < tamanho; ++i) {
+                    if (tabuleiro[i] == '_') {
+                        vazio = i;
+                    } else {
+                        if (tabuleiro[i] == 'B') mascaraBytes[ficha >> 3] |= (uint8_t)(1 << (ficha & 7));
+                        ficha++;
+                    }
+                }
+            }
+            anexarLittleEndian(buffer, (uint64_t)vazio, 2);
+            buffer.append(mascaraBytes.begin(), mascaraBytes.end());
+        } else {
+            if (porMascara) {
+                for (int i = 0, ficha = 0; i < tamanho; ++i) {
+                    if (i == vazio) {
+                        buffer += '_';
+                    } else {
+                        buffer += ((mascara >> ficha) & 1ULL) ? 'B' : 'A';
+                        ficha++;
+                    }
+                }
+            } else {
+                buffer.append(tabuleiro.begin(), tabuleiro.end());
+            }
+            buffer += '\n';
+        }
+        if (buffer.size() >= TAMANHO_BUFFER) {
+            saida.write(buffer.data(), (std::streamsize)buffer.size());
+            buffer.clear();
+        }
+    }
+    saida.write(buffer.data(), (std::streamsize)buffer.size());
+    return saida ? quantidade : -1;
+}
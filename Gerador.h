@@ -0,0 +1,111 @@
+#ifndef GERADOR_H
+#define GERADOR_H
+
+#include <vector>
+#include <string>
+#include <cstdint>
+
+// Gerador de tabuleiros uniformemente distribuidos e reproduziveis.
+//
+// Um tabuleiro com n fichas de cada cor e a posicao do vazio (2n + 1 opcoes)
+// mais a escolha de quais das 2n fichas sao 'B' (C(2n, n) opcoes), o que da
+// (2n+1)! / (n! n!) tabuleiros. Cada um tem um posto nesse intervalo:
+//     posto = vazio * C(2n, n) + indice da combinacao (ordem lexicografica)
+// e sortear um posto uniforme e desfaze-lo (desposto) da um tabuleiro uniforme.
+// Com mais de MAX_FICHAS_POSTO fichas de cada cor o total nao cabe em 64 bits;
+// nesse caso o vazio e sorteado a parte e as fichas sao embaralhadas
+// (Fisher-Yates), o que continua uniforme.
+//
+// O gerador pseudoaleatorio (splitmix64) e a reducao ao intervalo (rejeicao)
+// sao implementados aqui, para que a mesma semente produza as mesmas
+// instancias em qualquer compilador.
+//
+// Para ate MAX_FICHAS_DISTANCIAS fichas de cada cor, prepararDistancias() faz
+// uma busca em largura a partir do objetivo sobre todos os postos e agrupa os
+// tabuleiros pela distancia ate o objetivo, o que permite amostragem
+// estratificada (mesmo numero de instancias por distancia).
+//
+// Para ate MAX_FICHAS_DISTANCIAS_EXATAS fichas, distanciasAoObjetivo() e
+// distanciasDe() devolvem a distancia exata de todos os tabuleiros (um byte por
+// posto), com a busca em largura por camadas dividida entre threads: cada
+// thread expande um pedaco da fronteira e marca os vizinhos com troca atomica.
+class GeradorTabuleiros {
+public:
+    static const int MAX_FICHAS_POSTO = 30;
+    static const int MAX_FICHAS_DISTANCIAS = 10;
+    static const int MAX_FICHAS_DISTANCIAS_EXATAS = 12;
+    static const uint8_t DISTANCIA_DESCONHECIDA = 0xff;
+
+    enum FormatoLote {
+        LOTE_TEXTO = 1,   // uma linha por tabuleiro ("AB_BA...")
+        LOTE_BINARIO = 2  // cabecalho + registros de tamanho fixo (ver gravarLote)
+    };
+
+    GeradorTabuleiros(int numFichas, uint64_t semente);
+
+    // Familias fixas: fichas alternadas (ABAB_ABAB, o tabuleiro padrao do
+    // jogo) e as cores invertidas (AAA_BBB, o da comparacao de algoritmos)
+    static std::vector<char> intercalado(int numFichas);
+    static std::vector<char> invertido(int numFichas);
+
+    int numFichas() const { return n; }
+    // Quantidade de tabuleiros validos (0 se nao couber em 64 bits)
+    uint64_t totalTabuleiros() const { return total; }
+
+    // Apenas ate MAX_FICHAS_POSTO fichas de cada cor (senao retorna 0 / nao altera)
+    uint64_t posto(const std::vector<char>& tabuleiro) const;
+    void desposto(uint64_t p, std::vector<char>& tabuleiro) const;
+
+    // Tabuleiro uniforme entre todos os validos
+    void sortear(std::vector<char>& tabuleiro);
+    std::vector<char> sortear();
+
+    // Amostragem estratificada pela distancia ate o objetivo
+    bool prepararDistancias();
+    int distanciaMaxima() const { return inicioEstrato.empty() ? -1 : (int)inicioEstrato.size() - 2; }
+    uint64_t quantidadeComDistancia(int d) const;
+    bool sortearComDistancia(int d, std::vector<char>& tabuleiro);
+    // Percorre as distancias existentes em rodizio (0, 1, ..., max, 0, ...)
+    bool sortearEstratificado(std::vector<char>& tabuleiro);
+
+    // Distancia exata de cada posto ate o objetivo ou a partir de 'tabuleiro'
+    // (distancia[posto], DISTANCIA_DESCONHECIDA se inalcancavel). Retorna false
+    // com mais de MAX_FICHAS_DISTANCIAS_EXATAS fichas ou distancia acima de 254.
+    bool distanciasAoObjetivo(std::vector<uint8_t>& distancia, int threads) const;
+    bool distanciasDe(const std::vector<char>& tabuleiro, std::vector<uint8_t>& distancia, int threads) const;
+
+    // Grava 'quantidade' instancias; retorna quantas foram gravadas ou -1 em erro.
+    // Binario: "RGP1", numFichas (uint32), quantidade (uint64) e semente (uint64),
+    // em little-endian, e depois, por instancia, o vazio (uint16) seguido da
+    // mascara das fichas 'B' (bit i = i-esima ficha, ignorando o vazio) em
+    // ceil(2n/8) bytes.
+    long long gravarLote(const std::string& arquivo, long long quantidade, FormatoLote formato,
+                         bool estratificado);
+
+private:
+    uint64_t proximo();
+    uint64_t abaixoDe(uint64_t limite);
+    // Mesmo posto, com o tabuleiro como vazio + mascara das fichas 'B'
+    uint64_t postoMascara(int vazio, uint64_t mascara) const;
+    void despostoMascara(uint64_t p, int& vazio, uint64_t& mascara) const;
+    // Postos dos tabuleiros a um movimento; retorna quantos sao
+    int vizinhos(int vazio, uint64_t mascara, uint64_t destinos[4]) const;
+    bool buscaEmLarguraParalela(const std::vector<uint64_t>& origens, std::vector<uint8_t>& distancia,
+                                int threads) const;
+
+    int n;
+    int tamanho;
+    uint64_t semente;
+    uint64_t estado;
+    uint64_t combinacoes; // C(2n, n)
+    uint64_t total;
+    std::vector<std::vector<uint64_t> > binomial; // binomial[a][b] = C(a, b), a <= 2n
+
+    // Postos agrupados por distancia: os de distancia d estao em
+    // [inicioEstrato[d], inicioEstrato[d + 1]) de 'porDistancia'
+    std::vector<uint32_t> porDistancia;
+    std::vector<uint64_t> inicioEstrato;
+    int proximoEstrato;
+};
+
+#endif
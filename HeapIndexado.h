@@ -0,0 +1,117 @@
+#ifndef HEAP_INDEXADO_H
+#define HEAP_INDEXADO_H
+
+// Heap d-ario de minimo indexado pelos itens (inteiros 0..n-1), usado como
+// lista aberta do A*.
+//
+// Cada item aparece no maximo uma vez: a posicao de cada item no heap fica
+// num vetor ao lado, entao melhorar a prioridade de um item que ja esta na
+// fila (decrease-key) sobe o proprio elemento em vez de inserir uma copia.
+// A fila nunca tem entradas desatualizadas e o seu tamanho e o numero de
+// estados abertos.
+//
+// Com D = 4 a arvore tem metade da altura de um heap binario e os filhos de
+// um elemento ficam contiguos, o que reduz faltas de cache nas descidas.
+//
+// A ordem e pela prioridade e, entre prioridades iguais, pelo desempate
+// (menor primeiro). 'Alocador' vale para os dois vetores internos.
+
+#include <vector>
+#include <memory>
+#include <cstddef>
+
+template <int D = 4, class Alocador = std::allocator<char> >
+class HeapIndexado {
+public:
+    struct Elemento {
+        int prioridade;
+        int desempate;
+        int item;
+    };
+
+    bool empty() const { return heap.empty(); }
+    size_t size() const { return heap.size(); }
+
+    void reservar(size_t itens) {
+        heap.reserve(itens);
+        posicoes.reserve(itens);
+    }
+
+    bool contem(int item) const {
+        return item < (int)posicoes.size() && posicoes[item] >= 0;
+    }
+
+    const Elemento& topo() const { return heap[0]; }
+
+    // Insere o item ou, se ele ja estiver no heap, troca a sua prioridade
+    void inserirOuAtualizar(int item, int prioridade, int desempate) {
+        if (item >= (int)posicoes.size()) posicoes.resize(item + 1, -1);
+        Elemento e = { prioridade, desempate, item };
+        int p = posicoes[item];
+        if (p < 0) {
+            heap.push_back(e);
+            subir((int)heap.size() - 1, e);
+        } else if (menor(e, heap[p])) {
+            subir(p, e);
+        } else {
+            descer(p, e);
+        }
+    }
+
+    Elemento extrair() {
+        Elemento e = heap[0];
+        posicoes[e.item] = -1;
+        Elemento ultimo = heap.back();
+        heap.pop_back();
+        if (!heap.empty()) descer(0, ultimo);
+        return e;
+    }
+
+    void clear() {
+        heap.clear();
+        posicoes.clear();
+    }
+
+private:
+    static bool menor(const Elemento& a, const Elemento& b) {
+        return a.prioridade != b.prioridade ? a.prioridade < b.prioridade : a.desempate < b.desempate;
+    }
+
+    void colocar(int p, const Elemento& e) {
+        heap[p] = e;
+        posicoes[e.item] = p;
+    }
+
+    // Leva 'e' (que vai ocupar a posicao p) para cima ate o lugar certo
+    void subir(int p, const Elemento& e) {
+        while (p > 0) {
+            int pai = (p - 1) / D;
+            if (!menor(e, heap[pai])) break;
+            colocar(p, heap[pai]);
+            p = pai;
+        }
+        colocar(p, e);
+    }
+
+    void descer(int p, const Elemento& e) {
+        int n = (int)heap.size();
+        while (true) {
+            int primeiro = p * D + 1;
+            if (primeiro >= n) break;
+            int fim = primeiro + D < n ? primeiro + D : n;
+            int melhor = primeiro;
+            for (int f = primeiro + 1; f < fim; ++f) {
+                if (menor(heap[f], heap[melhor])) melhor = f;
+            }
+            if (!menor(heap[melhor], e)) break;
+            colocar(p, heap[melhor]);
+            p = melhor;
+        }
+        colocar(p, e);
+    }
+
+    std::vector<Elemento, typename std::allocator_traits<Alocador>::template rebind_alloc<Elemento> > heap;
+    std::vector<int, typename std::allocator_traits<Alocador>::template rebind_alloc<int> > posicoes; // posicao de cada item no heap, -1 se fora
+};
+
+#endif
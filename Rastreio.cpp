@@ -0,0 +1,129 @@
+#include "Rastreio.h"
+#include <vector>
+#include <mutex>
+#include <thread>
+#include <chrono>
+#include <cstdio>
+
+namespace {
+
+struct Evento {
+    const char* nome;
+    const char* categoria;
+    double inicio;
+    double duracao;
+    long long valor;
+};
+
+// Buffers nunca sao liberados: os de threads que terminaram voltam para o
+// registro e sao reaproveitados pela proxima thread (mesmo tid no rastreio).
+// A thread principal sempre ganha um buffer novo, so dela.
+struct BufferThread {
+    int tid;
+    bool emUso;
+    bool principal;
+    size_t proximo;              // posicao a sobrescrever quando cheio
+    unsigned long long total;    // eventos registrados, inclusive os sobrescritos
+    std::vector<Evento> eventos;
+};
+
+std::mutex travaRegistro;
+std::vector<BufferThread*> buffers;
+const std::chrono::steady_clock::time_point origem = std::chrono::steady_clock::now();
+// Inicializado antes de main, na thread principal
+const std::thread::id threadPrincipal = std::this_thread::get_id();
+
+struct DonoBuffer {
+    BufferThread* buffer = nullptr;
+    ~DonoBuffer() {
+        if (!buffer) return;
+        std::lock_guard<std::mutex> trava(travaRegistro);
+        buffer->emUso = false;
+    }
+};
+
+thread_local DonoBuffer dono;
+
+BufferThread* bufferDaThread() {
+    if (dono.buffer) return dono.buffer;
+    std::lock_guard<std::mutex> trava(travaRegistro);
+    bool principal = std::this_thread::get_id() == threadPrincipal;
+    for (BufferThread* b : buffers) {
+        if (!principal && !b->emUso) {
+            dono.buffer = b;
+            break;
+        }
+    }
+    if (!dono.buffer) {
+        BufferThread* b = new BufferThread();
+        b->tid = (int)buffers.size() + 1;
+        b->principal = principal;
+        b->proximo = 0;
+        b->total = 0;
+        buffers.push_back(b);
+        dono.buffer = b;
+    }
+    dono.buffer->emUso = true;
+    return dono.buffer;
+}
+
+void escreverEvento(std::FILE* f, const Evento& e, int tid, bool& primeiro) {
+    std::fprintf(f, "%s\n{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f",
+                 primeiro ? "" : ",", e.nome, e.categoria, tid, e.inicio, e.duracao);
+    if (e.valor >= 0) std::fprintf(f, ",\"args\":{\"valor\":%lld}", e.valor);
+    std::fputc('}', f);
+    primeiro = false;
+}
+
+} // namespace
+
+std::atomic<bool> Rastreio::ligado(false);
+
+void Rastreio::ativar(bool ligar) {
+    ligado.store(ligar, std::memory_order_relaxed);
+}
+
+double Rastreio::agora() {
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - origem).count();
+}
+
+void Rastreio::registrar(const char* nome, const char* categoria, double inicio, long long valor) {
+    BufferThread* b = bufferDaThread();
+    Evento e = { nome, categoria, inicio, agora() - inicio, valor };
+    if (b->eventos.size() < CAPACIDADE_POR_THREAD) {
+        b->eventos.push_back(e);
+    } else {
+        b->eventos[b->proximo] = e;
+        b->proximo = (b->proximo + 1) % CAPACIDADE_POR_THREAD;
+    }
+    b->total++;
+}
+
+bool Rastreio::gravar(const std::string& arquivo) {
+    std::lock_guard<std::mutex> trava(travaRegistro);
+    std::FILE* f = std::fopen(arquivo.c_str(), "w");
+    if (!f) return false;
+    unsigned long long descartados = 0;
+    bool primeiro = true;
+    std::fputs("{\"traceEvents\":[", f);
+    for (const BufferThread* b : buffers) {
+        std::fprintf(f, "%s\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"%s %d\"}}",
+                     primeiro ? "" : ",", b->tid, b->principal ? "principal" : "thread", b->tid);
+        primeiro = false;
+        // Do mais antigo ao mais recente
+        size_t n = b->eventos.size();
+        for (size_t i = 0; i < n; ++i) escreverEvento(f, b->eventos[(b->proximo + i) % n], b->tid, primeiro);
+        descartados += b->total - n;
+    }
+    std::fprintf(f, "\n],\"displayTimeUnit\":\"ms\",\"otherData\":{\"eventos_descartados\":%llu}}\n", descartados);
+    return std::fclose(f) == 0;
+}
+
+void Rastreio::limpar() {
+    std::lock_guard<std::mutex> trava(travaRegistro);
+    for (BufferThread* b : buffers) {
+        b->eventos.clear();
+        b->proximo = 0;
+        b->total = 0;
+    }
+}
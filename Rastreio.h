@@ -0,0 +1,65 @@
+#ifndef RASTREIO_H
+#define RASTREIO_H
+
+#include <atomic>
+#include <string>
+
+// Rastreio leve das fases do solucionador, exportado no formato de eventos
+// do Chrome (JSON "traceEvents"), que abre no Perfetto ou em chrome://tracing.
+//
+// Cada thread grava seus trechos num buffer circular proprio (os mais antigos
+// sao sobrescritos quando ele enche), sem travas no caminho de gravacao.
+// Desligado, um trecho custa so a leitura de um atomico. Os nomes e
+// categorias sao guardados por ponteiro e devem ser literais.
+//
+// gravar() e limpar() devem ser chamados sem buscas em andamento.
+class Rastreio {
+public:
+    static const size_t CAPACIDADE_POR_THREAD = 1 << 16;
+
+    static void ativar(bool ligar);
+    static bool ativo() { return ligado.load(std::memory_order_relaxed); }
+
+    // Microssegundos desde o primeiro uso
+    static double agora();
+    // Trecho completo [inicio, agora); 'valor' < 0 nao e exportado
+    static void registrar(const char* nome, const char* categoria, double inicio, long long valor = -1);
+
+    static bool gravar(const std::string& arquivo);
+    static void limpar();
+
+private:
+    static std::atomic<bool> ligado;
+};
+
+// Trecho com escopo: comeca na construcao e e registrado na destruicao
+class TrechoRastreio {
+public:
+    TrechoRastreio(const char* nome, const char* categoria, long long valor = -1)
+        : nome(nome), categoria(categoria), valor(valor), inicio(Rastreio::ativo() ? Rastreio::agora() : -1.0) {}
+    ~TrechoRastreio() {
+        if (inicio >= 0.0) Rastreio::registrar(nome, categoria, inicio, valor);
+    }
+
+    void definirValor(long long v) { valor = v; }
+
+    // Fecha o trecho atual e abre outro com o mesmo nome (camadas, iteracoes)
+    void proximo(long long novoValor) {
+        if (inicio >= 0.0) {
+            Rastreio::registrar(nome, categoria, inicio, valor);
+            inicio = Rastreio::agora();
+        }
+        valor = novoValor;
+    }
+
+private:
+    TrechoRastreio(const TrechoRastreio&);
+    TrechoRastreio& operator=(const TrechoRastreio&);
+
+    const char* nome;
+    const char* categoria;
+    long long valor;
+    double inicio;
+};
+
+#endif
@@ -1,20 +1,14 @@
 #include "ReguaPuzzle.h"
+#include "Gerador.h"
 #include <iostream>
+#include <limits>
 #include <algorithm>
-#include <random>
 #include <chrono>
-#include <cstdlib>
-#include <random>
-#include <chrono> // Necessário para usar o tempo
+#include <cstdint>
 
-#include <random>
-#ifdef _WIN32
-#include <windows.h>
-#else
-#include <cstring>
-#endif
-
-ReguaPuzzle::ReguaPuzzle(int num_fichas) : num_fichas(num_fichas), movimentos(0), jogoTerminado(false) {
+ReguaPuzzle::ReguaPuzzle(int num_fichas)
+    : num_fichas(num_fichas), movimentos(0), jogoTerminado(false), tabuleiroDefinidoManualmente(false), tela(std::cout),
+      dicasCarregadas(false) {
     tamanho = 2 * num_fichas + 1;
     tabuleiro.resize(tamanho);
     inicializarTabuleiro();
@@ -41,62 +35,16 @@ std::vector<char> ReguaPuzzle::getTabuleiro() const {
 
 
 
-int numeroAleatorio1a2() {
-    // Semeia o gerador com o tempo atual.
-    // time_since_epoch().count() retorna o número de nanossegundos desde 01/01/1970.
-    // É um valor excelente e altamente variável para usar como semente.
-    static unsigned int seed = std::chrono::high_resolution_clock::now().time_since_epoch().count();
-    static std::mt19937 gen(seed);
-
-    static std::uniform_int_distribution<> dist(1, 2);
-
-    return dist(gen);
-}
-
+// Tabuleiro uniforme entre todos os validos (o vazio pode estar em qualquer
+// posicao), sorteado de novo enquanto ja estiver resolvido
 void ReguaPuzzle::inicializarTabuleiro() {
-    int fichasA = num_fichas;
-    int fichasB = num_fichas;
-
-    for (int i = 0; i < tamanho; ++i) {
-        if (i == num_fichas) {
-            tabuleiro[i] = ESPACO_VAZIO;
-            continue; // Pula para a próxima iteração do loop
-        }
-
-        bool colocarA = (numeroAleatorio1a2() == 1);
-
-        // Tenta colocar a ficha A, se possível. Se não, tenta colocar a B.
-        if (colocarA && fichasA > 0) {
-            tabuleiro[i] = FICHA_AZUL;
-            fichasA--;
-        } else if (fichasB > 0) { // Se não pôde colocar A, tenta colocar B
-            tabuleiro[i] = FICHA_VERMELHA;
-            fichasB--;
-        } else { // Se não pode colocar B, então obrigatoriamente tem que colocar A
-            tabuleiro[i] = FICHA_AZUL;
-            fichasA--;
-        }
-    }
-    posicaoVazia = num_fichas;
-}
-
-void ReguaPuzzle::embaralharTabuleiro() {
-    // Embaralha o tabuleiro fazendo movimentos aleatórios válidos
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    std::uniform_int_distribution<> dis(0, tamanho - 1);
-    int tentativas = 0;
+    static uint64_t semente = (uint64_t)std::chrono::high_resolution_clock::now().time_since_epoch().count();
+    semente += 0x9e3779b97f4a7c15ULL;
+    GeradorTabuleiros gerador(num_fichas, semente);
     do {
-        inicializarTabuleiro();
-        for (int i = 0; i < 50; i++) {
-            int posicao = dis(gen);
-            if (podeMover(posicao)) {
-                moverFicha(posicao);
-            }
-        }
-        tentativas++;
-        // Garante que não está na solução e não está igual ao inicial
-    } while (verificarVitoria() && tentativas < 100);
+        gerador.sortear(tabuleiro);
+    } while (verificarVitoria());
+    posicaoVazia = (int)(std::find(tabuleiro.begin(), tabuleiro.end(), ESPACO_VAZIO) - tabuleiro.begin());
 }
 
 bool ReguaPuzzle::movimentoValido(int posicao) const {
@@ -155,116 +103,119 @@ void ReguaPuzzle::moverFicha(int posicao) {
     }
 }
 
+// Vitoria com todas as vermelhas antes de todas as azuis (B B B ... A A A),
+// o mesmo objetivo do Solver e das dicas; o vazio pode estar em qualquer posicao
 bool ReguaPuzzle::verificarVitoria() const {
-    bool encontrouVermelha = false;
+    bool encontrouAzul = false;
     for (int i = 0; i < tamanho; ++i) {
-        if (tabuleiro[i] == FICHA_VERMELHA) {
-            encontrouVermelha = true;
+        if (tabuleiro[i] == FICHA_AZUL) {
+            encontrouAzul = true;
         }
-        if (tabuleiro[i] == FICHA_AZUL && encontrouVermelha) {
-            // Encontrou uma azul depois de uma vermelha → não venceu
+        if (tabuleiro[i] == FICHA_VERMELHA && encontrouAzul) {
+            // Encontrou uma vermelha depois de uma azul → não venceu
             return false;
         }
     }
-    return true; // Nenhuma azul depois de vermelha → vitória!
+    return true; // Nenhuma vermelha depois de azul → vitória!
 }
 
-void ReguaPuzzle::exibirTabuleiro() const {
-    std::cout << "\nTabuleiro atual (Movimentos: " << movimentos << "):\n";
-    std::cout << "+";
-    for (int i = 0; i < tamanho; ++i) std::cout << "-+";
-    std::cout << "\n|";
-    for (int i = 0; i < tamanho; ++i) std::cout << tabuleiro[i] << "|";
-    std::cout << "\n+";
-    for (int i = 0; i < tamanho; ++i) std::cout << "-+";
-    std::cout << "\n ";
-    for (int i = 0; i < tamanho; ++i) std::cout << i << " ";
-    std::cout << "\n ";
-    for (int i = 0; i < tamanho; ++i) {
-        if (podeMover(i)) {
-            std::cout << "^ ";
-        } else {
-            std::cout << "  ";
-        }
-    }
-    std::cout << "\n ";
-    for (int i = 0; i < tamanho; ++i) {
-        if (podeMover(i)) {
-            std::cout << i << " ";
-        } else {
-            std::cout << "  ";
-        }
+// Posicoes das fichas que podem ir para o vazio (no maximo 4, em volta dele)
+std::vector<int> ReguaPuzzle::posicoesMoviveis() const {
+    std::vector<int> moviveis;
+    for (int p = posicaoVazia - 2; p <= posicaoVazia + 2; ++p) {
+        if (podeMover(p)) moviveis.push_back(p);
     }
-    std::cout << "\n\n";
+    return moviveis;
 }
 
-void ReguaPuzzle::exibirInstrucoes() const {
-    std::cout << "Instrucoes:\n";
-    std::cout << "- Digite o numero da posicao da ficha que deseja mover\n";
-    std::cout << "- Use 'R' para reiniciar o jogo\n";
-    std::cout << "- Use 'Q' para sair\n";
-    std::cout << "- Objetivo: Organizar as fichas por cor (";
-    for (int i = 0; i < num_fichas; ++i) std::cout << FICHA_VERMELHA << " ";
-    std::cout << ESPACO_VAZIO << " ";
-    for (int i = 0; i < num_fichas; ++i) std::cout << FICHA_AZUL << " ";
-    std::cout << ")\n\n";
+void ReguaPuzzle::exibirTabuleiro(const std::string& mensagem, const std::string& prompt) {
+    tela.desenhar(tabuleiro, movimentos, posicoesMoviveis(), mensagem, prompt);
 }
 
-char ReguaPuzzle::obterEntrada() const {
+std::vector<std::string> ReguaPuzzle::instrucoes() const {
+    std::vector<std::string> linhas;
+    linhas.push_back("Instrucoes:");
+    linhas.push_back("- Digite o numero da posicao da ficha que deseja mover");
+    linhas.push_back("- Use 'H' para pedir uma dica");
+    linhas.push_back("- Use 'R' para reiniciar o jogo");
+    linhas.push_back("- Use 'Q' para sair");
+    std::string objetivo = "- Objetivo: Organizar as fichas por cor (";
+    for (int i = 0; i < num_fichas; ++i) (objetivo += FICHA_VERMELHA) += ' ';
+    (objetivo += ESPACO_VAZIO) += ' ';
+    for (int i = 0; i < num_fichas; ++i) (objetivo += FICHA_AZUL) += ' ';
+    objetivo += ')';
+    linhas.push_back(objetivo);
+    linhas.push_back("");
+    return linhas;
+}
+
+std::string ReguaPuzzle::obterEntrada() const {
     std::string entrada;
-    std::cout << "Digite sua escolha: ";
-    std::cin >> entrada;
-    if (entrada.length() == 1) return entrada[0];
-    return '\0';
+    if (!(std::cin >> entrada)) return "Q";
+    return entrada;
 }
 
-void ReguaPuzzle::limparTela() const {
-#ifdef _WIN32
-    system("cls");
-#else
-    system("clear");
-#endif
+// Converte a entrada em uma posicao (aceita varios digitos); -1 se nao for um numero
+static int lerPosicao(const std::string& entrada) {
+    if (entrada.empty() || entrada.size() > 9) return -1;
+    int posicao = 0;
+    for (char c : entrada) {
+        if (c < '0' || c > '9') return -1;
+        posicao = posicao * 10 + (c - '0');
+    }
+    return posicao;
 }
 
 void ReguaPuzzle::iniciarJogo() {
+    const std::string PROMPT = "Digite sua escolha: ";
     reiniciarJogo();
+    if (!dicasCarregadas) {
+        dicas.carregar();
+        dicasCarregadas = true;
+    }
+    tela.definirRodape(instrucoes());
+    tela.invalidar();
+    std::string mensagem;
     while (!jogoTerminado) {
-        limparTela();
-        exibirTabuleiro();
-        exibirInstrucoes();
-        char entrada = obterEntrada();
-        if (entrada == 'Q' || entrada == 'q') {
+        exibirTabuleiro(mensagem, PROMPT);
+        mensagem.clear();
+        std::string entrada = obterEntrada();
+        if (entrada == "Q" || entrada == "q") {
+            tela.sairDoQuadro();
             std::cout << "Jogo interrompido!\n";
             break;
-        } else if (entrada == 'R' || entrada == 'r') {
+        } else if (entrada == "R" || entrada == "r") {
             reiniciarJogo();
             continue;
-        } else if (entrada >= '0' && entrada <= '9') {
-            int posicao = entrada - '0';
-            if (podeMover(posicao)) {
-                moverFicha(posicao);
-                if (verificarVitoria()) {
-                    limparTela();
-                    exibirTabuleiro();
-                    std::cout << "\n🎉 PARABÉNS! Você venceu em " << movimentos << " movimentos! 🎉\n";
-                    jogoTerminado = true;
-                }
-            } else {
-                std::cout << "Movimento invalido! Pressione Enter para continuar...\n";
-                std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-                std::cin.get();
+        } else if (entrada == "H" || entrada == "h") {
+            MotorDicas::Dica dica = dicas.sugerir(tabuleiro);
+            if (dica.posicao >= 0) {
+                mensagem = "Dica: mova a ficha da posicao " + std::to_string(dica.posicao) +
+                           " (faltariam pelo menos " + std::to_string(dica.estimativa) + " movimentos)";
             }
+            continue;
+        }
+        int posicao = lerPosicao(entrada);
+        if (posicao < 0) {
+            mensagem = "Entrada invalida: " + entrada;
+        } else if (!podeMover(posicao)) {
+            mensagem = "Movimento invalido: " + entrada;
         } else {
-            std::cout << "Entrada invalida! Pressione Enter para continuar...\n";
-            std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-            std::cin.get();
+            dicas.aprender(tabuleiro);
+            moverFicha(posicao);
+            if (verificarVitoria()) {
+                jogoTerminado = true;
+                mensagem = "PARABENS! Voce venceu em " + std::to_string(movimentos) + " movimentos!";
+                exibirTabuleiro(mensagem, "Pressione Enter para voltar ao menu...");
+            }
         }
     }
     tabuleiroDefinidoManualmente = false; // Permite novo jogo normal depois
+    dicas.salvar();
     if (jogoTerminado) {
-        std::cout << "\nPressione Enter para voltar ao menu...\n";
         std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
         std::cin.get();
+        tela.sairDoQuadro();
     }
 }
 
@@ -3,7 +3,9 @@
 
 #include <vector>
 #include <string>
-    
+#include "TelaJogo.h"
+#include "Dicas.h"
+
 class ReguaPuzzle {
 private:
     std::vector<char> tabuleiro;
@@ -13,6 +15,9 @@ private:
     int movimentos;
     bool jogoTerminado;
     bool tabuleiroDefinidoManualmente;
+    TelaJogo tela;
+    MotorDicas dicas;
+    bool dicasCarregadas;
     
     // Constantes para cores das fichas
     static const char FICHA_AZUL = 'A';
@@ -21,15 +26,13 @@ private:
     
     // Métodos privados
     void inicializarTabuleiro();
-    void embaralharTabuleiro();
     bool movimentoValido(int posicao) const;
     bool podeMover(int posicao) const;
     void moverFicha(int posicao);
-    bool verificarVitoria() const;
-    void exibirTabuleiro() const;
-    void exibirInstrucoes() const;
-    char obterEntrada() const;
-    void limparTela() const;
+    std::vector<int> posicoesMoviveis() const;
+    void exibirTabuleiro(const std::string& mensagem, const std::string& prompt);
+    std::vector<std::string> instrucoes() const;
+    std::string obterEntrada() const;
     
 public:
     ReguaPuzzle(int num_fichas = 3);
@@ -39,6 +42,7 @@ public:
     void reiniciarJogo();
     int getMovimentos() const;
     bool getJogoTerminado() const;
+    bool verificarVitoria() const;
     void setNumFichas(int n);
     int getNumFichas() const;
     std::vector<char> getTabuleiro() const;
@@ -1,24 +1,16 @@
 #include "Solver.h"
+#include "SolverNucleo.h"
+#include "Rastreio.h"
 #include <iostream>
+#include <fstream>
 #include <algorithm>
 #include <chrono>
-#include <stack>
-#include <set>
-#include <unordered_set>
-#include <unordered_map>
-#include <thread>
-#include <climits> // Para INT_MAX
-
-
-// --- Timeout padrão para todos algoritmos (em segundos) ---
-const double TIMEOUT_PADRAO = 10.0;
-
-// --- Função auxiliar para checar timeout ---
-bool estourouTimeout(const std::chrono::high_resolution_clock::time_point& start, double timeout) {
-    auto now = std::chrono::high_resolution_clock::now();
-    double elapsed = std::chrono::duration<double>(now - start).count();
-    return elapsed > timeout;
-}
+#if defined(_WIN32)
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <time.h>
+#endif
 
 std::string Solver::tabuleiroParaString(const std::vector<char>& tabuleiro) {
     std::string resultado;
@@ -166,318 +158,25 @@ int Solver::heuristicaFichasForaDoLugar(const std::vector<char>& tabuleiro) {
     return fichasForaDoLugar;
 }
 
-
-// BFS (Busca em Largura)
-SolverStats Solver::resolverBFS(const std::vector<char>& tabuleiroInicial) {
-    SolverStats stats;
-    auto start = std::chrono::high_resolution_clock::now();
-    std::queue<Estado> fila;
-    std::unordered_set<std::string> visitados;
-    int nos_expandidos = 0;
-    int nos_visitados = 0;
-    int soma_ramificacao = 0;
-    int total_nos = 0;
-    
-    fila.push(Estado(tabuleiroInicial, {}, 0));
-    visitados.insert(tabuleiroParaString(tabuleiroInicial));
-    
-    while (!fila.empty()) {
-        Estado atual = fila.front();
-        fila.pop();
-        nos_expandidos++;
-        
-        if (verificarVitoria(atual.tabuleiro)) {
-            stats.caminho = atual.movimentos;
-            stats.profundidade = atual.profundidade;
-            stats.custo = (int)atual.movimentos.size();
-            break;
-        }
-        
-        std::vector<int> movimentosPossiveis = encontrarMovimentosPossiveis(atual.tabuleiro);
-        soma_ramificacao += movimentosPossiveis.size();
-        total_nos++;
-        
-        for (int movimento : movimentosPossiveis) {
-            std::vector<char> novoTabuleiro = aplicarMovimento(atual.tabuleiro, movimento);
-            std::string novoTabuleiroStr = tabuleiroParaString(novoTabuleiro);
-            
-            if (visitados.find(novoTabuleiroStr) == visitados.end()) {
-                visitados.insert(novoTabuleiroStr);
-                nos_visitados++;
-                std::vector<int> novosMovimentos = atual.movimentos;
-                novosMovimentos.push_back(movimento);
-                fila.push(Estado(novoTabuleiro, novosMovimentos, atual.profundidade + 1));
-            }
-        }
-    }
-    
-    auto end = std::chrono::high_resolution_clock::now();
-    stats.nos_expandidos = nos_expandidos;
-    stats.nos_visitados = nos_visitados;
-    stats.fator_ramificacao = total_nos > 0 ? (double)soma_ramificacao / total_nos : 0.0;
-    stats.tempo_execucao = std::chrono::duration<double>(end - start).count();
-    return stats;
-}
-
-// Backtracking
-SolverStats Solver::resolverBacktracking(const std::vector<char>& tabuleiroInicial, double timeout) {
-    SolverStats stats;
-    auto start = std::chrono::high_resolution_clock::now();
-    std::vector<int> caminho;
-    std::set<std::string> visitados;
-    int nos_expandidos = 0;
-    int nos_visitados = 0;
-    int soma_ramificacao = 0;
-    int total_nos = 0;
-    bool encontrou = false;
-    const int LIMITE_PROFUNDIDADE = 10000;
-    std::function<bool(const std::vector<char>&, int)> backtrack = 
-        [&](const std::vector<char>& tabuleiro, int profundidade) -> bool {
-            if (estourouTimeout(start, timeout)) return false;
-            if (profundidade > LIMITE_PROFUNDIDADE) return false;
-            nos_expandidos++;
-            if (verificarVitoria(tabuleiro)) {
-                stats.caminho = caminho;
-                stats.profundidade = profundidade;
-                stats.custo = (int)caminho.size();
-                encontrou = true;
-                return true;
-            }
-            std::string tabStr = tabuleiroParaString(tabuleiro);
-            visitados.insert(tabStr);
-            std::vector<int> movimentosPossiveis = encontrarMovimentosPossiveis(tabuleiro);
-            soma_ramificacao += movimentosPossiveis.size();
-            total_nos++;
-            for (int movimento : movimentosPossiveis) {
-                std::vector<char> novoTabuleiro = aplicarMovimento(tabuleiro, movimento);
-                std::string novoTabuleiroStr = tabuleiroParaString(novoTabuleiro);
-                if (visitados.find(novoTabuleiroStr) == visitados.end()) {
-                    nos_visitados++;
-                    caminho.push_back(movimento);
-                    if (backtrack(novoTabuleiro, profundidade + 1)) {
-                        return true;
-                    }
-                    caminho.pop_back();
-                }
-            }
-            visitados.erase(tabStr);
-            return false;
-        };
-    backtrack(tabuleiroInicial, 0);
-    auto end = std::chrono::high_resolution_clock::now();
-    if (!encontrou) {
-        stats.caminho.clear();
-        stats.profundidade = -1;
-        stats.custo = -1;
-    }
-    stats.nos_expandidos = nos_expandidos;
-    stats.nos_visitados = nos_visitados;
-    stats.fator_ramificacao = total_nos > 0 ? (double)soma_ramificacao / total_nos : 0.0;
-    stats.tempo_execucao = std::chrono::duration<double>(end - start).count();
-    return stats;
-}
-
-
-// UCS (Uniform Cost Search)
-SolverStats Solver::resolverOrdenada(const std::vector<char>& tabuleiroInicial) {
-    SolverStats stats;
-    auto start = std::chrono::high_resolution_clock::now();
-    
-    // Priority queue ordenada por custo g
-    auto comparador = [](const Estado& a, const Estado& b) {
-        return a.custo_g > b.custo_g;
-    };
-    std::priority_queue<Estado, std::vector<Estado>, decltype(comparador)> fila(comparador);
-    std::unordered_set<std::string> visitados;
-    int nos_expandidos = 0;
-    int nos_visitados = 0;
-    int soma_ramificacao = 0;
-    int total_nos = 0;
-    
-    fila.push(Estado(tabuleiroInicial, {}, 0, 0, 0));
-    visitados.insert(tabuleiroParaString(tabuleiroInicial));
-    
-    while (!fila.empty()) {
-        Estado atual = fila.top();
-        fila.pop();
-        nos_expandidos++;
-        
-        if (verificarVitoria(atual.tabuleiro)) {
-            stats.caminho = atual.movimentos;
-            stats.profundidade = atual.profundidade;
-            stats.custo = atual.custo_g;
-            break;
-        }
-        
-        std::vector<int> movimentosPossiveis = encontrarMovimentosPossiveis(atual.tabuleiro);
-        soma_ramificacao += movimentosPossiveis.size();
-        total_nos++;
-        
-        for (int movimento : movimentosPossiveis) {
-            std::vector<char> novoTabuleiro = aplicarMovimento(atual.tabuleiro, movimento);
-            std::string novoTabuleiroStr = tabuleiroParaString(novoTabuleiro);
-            
-            if (visitados.find(novoTabuleiroStr) == visitados.end()) {
-                visitados.insert(novoTabuleiroStr);
-                nos_visitados++;
-                std::vector<int> novosMovimentos = atual.movimentos;
-                novosMovimentos.push_back(movimento);
-                fila.push(Estado(novoTabuleiro, novosMovimentos, atual.profundidade + 1, 
-                               atual.custo_g + 1, 0));
-            }
-        }
-    }
-    
-    auto end = std::chrono::high_resolution_clock::now();
-    stats.nos_expandidos = nos_expandidos;
-    stats.nos_visitados = nos_visitados;
-    stats.fator_ramificacao = total_nos > 0 ? (double)soma_ramificacao / total_nos : 0.0;
-    stats.tempo_execucao = std::chrono::duration<double>(end - start).count();
-    return stats;
-}
-
-// Busca Gulosa
-SolverStats Solver::resolverGulosa(const std::vector<char>& tabuleiroInicial, int heuristica) {
-    SolverStats stats;
-    auto start = std::chrono::high_resolution_clock::now();
-    
-    // Priority queue ordenada por heuristica h
-    auto comparador = [](const Estado& a, const Estado& b) {
-        return a.custo_h > b.custo_h;
-    };
-    std::priority_queue<Estado, std::vector<Estado>, decltype(comparador)> fila(comparador);
-    std::unordered_set<std::string> visitados;
-    int nos_expandidos = 0;
-    int nos_visitados = 0;
-    int soma_ramificacao = 0;
-    int total_nos = 0;
-    int h_inicial = (heuristica == 2) ? heuristicaFichasForaDoLugar(tabuleiroInicial) : heuristicaManhattan(tabuleiroInicial);
-    fila.push(Estado(tabuleiroInicial, {}, 0, 0, h_inicial));
-    visitados.insert(tabuleiroParaString(tabuleiroInicial));
-    
-    while (!fila.empty()) {
-        Estado atual = fila.top();
-        fila.pop();
-        nos_expandidos++;
-        
-        if (verificarVitoria(atual.tabuleiro)) {
-            stats.caminho = atual.movimentos;
-            stats.profundidade = atual.profundidade;
-            stats.custo = (int)atual.movimentos.size();
-            break;
-        }
-        
-        std::vector<int> movimentosPossiveis = encontrarMovimentosPossiveis(atual.tabuleiro);
-        
-        soma_ramificacao += movimentosPossiveis.size();
-        total_nos++;
-        
-        for (int movimento : movimentosPossiveis) {
-            std::vector<char> novoTabuleiro = aplicarMovimento(atual.tabuleiro, movimento);
-            std::string novoTabuleiroStr = tabuleiroParaString(novoTabuleiro);
-            
-            if (visitados.find(novoTabuleiroStr) == visitados.end()) {
-                visitados.insert(novoTabuleiroStr);
-                nos_visitados++;
-                std::vector<int> novosMovimentos = atual.movimentos;
-                novosMovimentos.push_back(movimento);
-                int h = (heuristica == 2) ? heuristicaFichasForaDoLugar(novoTabuleiro) : heuristicaManhattan(novoTabuleiro);
-                fila.push(Estado(novoTabuleiro, novosMovimentos, atual.profundidade + 1, 0, h));
-            }
-        }
-    }
-    
-    auto end = std::chrono::high_resolution_clock::now();
-    if (stats.caminho.empty()) {
-        stats.profundidade = -1;
-        stats.custo = -1;
-    }
-    stats.nos_expandidos = nos_expandidos;
-    stats.nos_visitados = nos_visitados;
-    stats.fator_ramificacao = total_nos > 0 ? (double)soma_ramificacao / total_nos : 0.0;
-    stats.tempo_execucao = std::chrono::duration<double>(end - start).count();
-    return stats;
-}
-
-// A*
-SolverStats Solver::resolverAStar(const std::vector<char>& tabuleiroInicial, int heuristica) {
-    SolverStats stats;
-    auto start = std::chrono::high_resolution_clock::now();
-
-    auto comparador = [](const Estado& a, const Estado& b) {
-        return (a.custo_g + a.custo_h) > (b.custo_g + b.custo_h);
-    };
-    std::priority_queue<Estado, std::vector<Estado>, decltype(comparador)> fila(comparador);
-    std::unordered_set<std::string> visitados;
-    int nos_expandidos = 0;
-    int nos_visitados = 0;
-    int soma_ramificacao = 0;
-    int total_nos = 0;
-    
-    // Gerar estado final para usar na heurística
-    std::vector<char> estadoFinal = gerarEstadoFinal(tabuleiroInicial);
-    int h_inicial = (heuristica == 2) ? heuristicaFichasForaDoLugar(tabuleiroInicial) : heuristicaManhattan(tabuleiroInicial);
-    fila.push(Estado(tabuleiroInicial, {}, 0, 0, h_inicial));
-    visitados.insert(tabuleiroParaString(tabuleiroInicial));
-
-    while (!fila.empty()) {
-        Estado atual = fila.top();
-        fila.pop();
-        nos_expandidos++;
-
-        if (verificarVitoria(atual.tabuleiro)) {
-            stats.caminho = atual.movimentos;
-            stats.profundidade = atual.profundidade;
-            stats.custo = atual.custo_g;
-            break;
-        }
-
-        std::vector<int> movimentosPossiveis = encontrarMovimentosPossiveis(atual.tabuleiro);
-        
-        // REMOVIDO: Ordenação dos movimentos no A* para evitar problemas de eficiência
-        
-        soma_ramificacao += movimentosPossiveis.size();
-        total_nos++;
-
-        for (int movimento : movimentosPossiveis) {
-            std::vector<char> novoTabuleiro = aplicarMovimento(atual.tabuleiro, movimento);
-            std::string novoTabuleiroStr = tabuleiroParaString(novoTabuleiro);
-
-            if (visitados.find(novoTabuleiroStr) == visitados.end()) {
-                visitados.insert(novoTabuleiroStr);
-                nos_visitados++;
-                std::vector<int> novosMovimentos = atual.movimentos;
-                novosMovimentos.push_back(movimento);
-                int h = (heuristica == 2) ? heuristicaFichasForaDoLugar(novoTabuleiro) : heuristicaManhattan(novoTabuleiro);
-                fila.push(Estado(novoTabuleiro, novosMovimentos, atual.profundidade + 1,
-                                 atual.custo_g + 1, h));
-            }
-        }
-    }
-
-    auto end = std::chrono::high_resolution_clock::now();
-    if (stats.caminho.empty()) {
-        stats.profundidade = -1;
-        stats.custo = -1;
+// Pares (A, B) com o A antes do B. Deslizar nao muda a ordem das fichas e cada
+// pulo inverte no maximo um desses pares, entao a heuristica e admissivel e consistente.
+int Solver::heuristicaInversoes(const std::vector<char>& tabuleiro) {
+    int inversoes = 0;
+    int numA = 0;
+    for (char c : tabuleiro) {
+        if (c == 'A') numA++;
+        else if (c == 'B') inversoes += numA;
     }
-    stats.nos_expandidos = nos_expandidos;
-    stats.nos_visitados = nos_visitados;
-    stats.fator_ramificacao = total_nos > 0 ? (double)soma_ramificacao / total_nos : 0.0;
-    stats.tempo_execucao = std::chrono::duration<double>(end - start).count();
-    return stats;
+    return inversoes;
 }
 
-// Funções auxiliares para IDA*
-int Solver::calcularCusto(const std::vector<char>& tabuleiro) {
-    // Para este problema, o custo é simplesmente o número de movimentos
-    // Como não temos acesso ao caminho atual, retornamos 0
-    // O custo real será calculado durante a busca
-    return 0;
-}
 
+// Funções auxiliares
 int Solver::heuristica(const std::vector<char>& tabuleiro, int tipo) {
     if (tipo == 2) {
         return heuristicaFichasForaDoLugar(tabuleiro);
+    } else if (tipo == 3) {
+        return heuristicaInversoes(tabuleiro);
     } else {
         return heuristicaManhattan(tabuleiro);
     }
@@ -517,219 +216,339 @@ std::vector<char> Solver::gerarEstadoFinal(const std::vector<char>& tabuleiro) {
 
 
 
-SolverStats Solver::resolverIDAStar(const std::vector<char>& tabuleiroInicial, int heuristica) {
-    SolverStats stats;
-    auto start = std::chrono::high_resolution_clock::now();
-    std::vector<int> caminho;
-    int nos_expandidos = 0;
-    int nos_visitados = 0;
-    int soma_ramificacao = 0;
-    int total_nos = 0;
-    bool encontrou = false;
-    bool timeout_ocorreu = false;
-
-    int h_inicial = (heuristica == 2) ? heuristicaFichasForaDoLugar(tabuleiroInicial) : heuristicaManhattan(tabuleiroInicial);
-    int limite = h_inicial;
-
-    std::function<bool(const std::vector<char>&, int, int, std::set<std::string>&)> idaStar = 
-        [&](const std::vector<char>& tabuleiro, int profundidade, int custo_g, std::set<std::string>& visitados) -> bool {
-            // Verifica timeout
-            auto now = std::chrono::high_resolution_clock::now();
-            double tempo_decorrido = std::chrono::duration<double>(now - start).count();
-            if (tempo_decorrido > TIMEOUT_PADRAO) {
-                timeout_ocorreu = true;
-                return false;
-            }
-
-            nos_expandidos++;
+// Solucao construtiva (sem busca), em O(n^2) movimentos e tempo.
+//
+// As fichas 'B' sao levadas, da esquerda para a direita, ate a sua posicao
+// final na ordem das fichas. Para cada 'B', o vazio e deslizado ate ficar
+// logo a direita dela (deslizar nao muda a ordem das fichas) e entao, enquanto
+// houver um 'A' a esquerda, o 'A' pula por cima da 'B' para o vazio e a 'B'
+// desliza para a esquerda: dois movimentos por inversao desfeita. O tabuleiro
+// e atualizado no lugar e cada movimento e entregue a 'emitir', sem guardar o
+// caminho. Retorna o numero de movimentos, ou -1 se o tabuleiro for invalido.
+long long Solver::construirSolucao(const std::vector<char>& tabuleiroInicial, const std::function<void(int)>& emitir) {
+    int numFichas = 0;
+    int numA = 0, numVazio = 0;
+    for (char c : tabuleiroInicial) {
+        if (c == 'B') numFichas++;
+        else if (c == 'A') numA++;
+        else if (c == '_') numVazio++;
+        else return -1;
+    }
+    if (numVazio != 1 || numA != numFichas) return -1;
+
+    std::vector<char> cel = tabuleiroInicial;
+    int tamanho = (int)cel.size();
+    int vazio = encontrarEspacoVazio(cel);
+    long long movimentos = 0;
+
+    // Move a ficha da posicao 'posicao' para o vazio
+    auto mover = [&](int posicao) {
+        std::swap(cel[posicao], cel[vazio]);
+        vazio = posicao;
+        emitir(posicao);
+        movimentos++;
+    };
 
-            if (verificarVitoria(tabuleiro)) {
-                stats.caminho = caminho;
-                stats.profundidade = profundidade;
-                stats.custo = custo_g;
-                encontrou = true;
-                return true;
+    int busca = 0; // proxima celula a partir da qual procurar a proxima 'B'
+    for (int i = 0; i < numFichas; ++i) {
+        int p = busca;
+        while (p < tamanho && cel[p] != 'B') p++;
+        if (p >= tamanho) break;
+
+        // Quantos 'A' estao antes desta 'B' (se nenhum, ela ja esta no lugar)
+        bool temA = false;
+        for (int k = p - 1; k >= 0 && cel[k] != 'B'; --k) {
+            if (cel[k] == 'A') {
+                temA = true;
+                break;
             }
+        }
+        if (!temA) {
+            busca = p + 1;
+            continue;
+        }
 
-            int h = (heuristica == 2) ? heuristicaFichasForaDoLugar(tabuleiro) : heuristicaManhattan(tabuleiro);
-            int f = custo_g + h;
-            if (f > limite) return false;
-
-            std::string tabStr = tabuleiroParaString(tabuleiro);
-            visitados.insert(tabStr);
-            std::vector<int> movimentosPossiveis = encontrarMovimentosPossiveis(tabuleiro);
-            soma_ramificacao += movimentosPossiveis.size();
-            total_nos++;
-
-            for (int movimento : movimentosPossiveis) {
-                std::vector<char> novoTabuleiro = aplicarMovimento(tabuleiro, movimento);
-                std::string novoTabuleiroStr = tabuleiroParaString(novoTabuleiro);
-
-                if (visitados.find(novoTabuleiroStr) == visitados.end()) {
-                    nos_visitados++;
-                    caminho.push_back(movimento);
-
-                    if (idaStar(novoTabuleiro, profundidade + 1, custo_g + 1, visitados)) {
-                        return true;
-                    }
-
-                    caminho.pop_back();
-
-                    if (timeout_ocorreu) return false; // Interrompe busca se timeout ocorrer em chamadas recursivas
-                }
+        if (p == tamanho - 1) {
+            // Sem espaco a direita: leva o vazio para p - 2, a 'B' pula para a
+            // esquerda e o 'A' desliza, deixando o vazio logo a direita da 'B'
+            while (vazio < p - 2) mover(vazio + 1);
+            while (vazio > p - 2) mover(vazio - 1);
+            mover(p);
+            mover(p - 1);
+            p -= 2;
+        } else {
+            // Desliza o vazio ate p + 1 (se passar pela 'B', ela anda uma casa)
+            while (vazio < p + 1) {
+                if (vazio + 1 == p) p = vazio;
+                mover(vazio + 1);
             }
-
-            visitados.erase(tabStr);
-            return false;
-        };
-
-    while (true) {
-        if (timeout_ocorreu) break;
-
-        std::set<std::string> visitados;
-        caminho.clear();
-
-        if (idaStar(tabuleiroInicial, 0, 0, visitados)) {
-            break;
+            while (vazio > p + 1) mover(vazio - 1);
         }
 
-        limite++;
+        // Vazio a direita da 'B': o 'A' da esquerda pula e a 'B' desliza
+        while (p > 0 && cel[p - 1] == 'A') {
+            mover(p - 1);
+            mover(p);
+            p--;
+        }
+        busca = p + 1;
     }
+    return movimentos;
+}
 
+SolverStats Solver::resolverConstrutivo(const std::vector<char>& tabuleiroInicial) {
+    SolverStats stats;
+    auto start = std::chrono::high_resolution_clock::now();
+    stats.caminho = CaminhoCompacto(encontrarEspacoVazio(tabuleiroInicial));
+    long long movimentos = construirSolucao(tabuleiroInicial, [&stats](int posicao) {
+        stats.caminho.adicionar(posicao);
+    });
     auto end = std::chrono::high_resolution_clock::now();
-    if (!encontrou) {
-        stats.caminho.clear();
+    if (movimentos < 0) {
+        stats.caminho = CaminhoCompacto();
         stats.profundidade = -1;
         stats.custo = -1;
+    } else {
+        stats.profundidade = (int)stats.caminho.size();
+        stats.custo = (int)stats.caminho.size();
     }
-
-    stats.nos_expandidos = nos_expandidos;
-    stats.nos_visitados = nos_visitados;
-    stats.fator_ramificacao = total_nos > 0 ? (double)soma_ramificacao / total_nos : 0.0;
     stats.tempo_execucao = std::chrono::duration<double>(end - start).count();
-
     return stats;
 }
 
-SolverStats Solver::resolverDFS(const std::vector<char>& tabuleiroInicial, double timeout) {
-    SolverStats stats;
-    auto start = std::chrono::high_resolution_clock::now();
+// Modelo de custo dos movimentos. Custos negativos sao tratados como 0.
+int ModeloCusto::custo(int origem, int vazio) const {
+    int c = (origem == vazio - 1 || origem == vazio + 1) ? deslizar : pulo;
+    if (origem >= 0 && origem < (int)posicao.size()) c += posicao[origem];
+    return std::max(0, c);
+}
 
-    std::stack<Estado> pilha;
-    std::set<std::string> visitados;
-    int nos_expandidos = 0;  // Nós que geraram filhos
-    int nos_visitados = 0;   // Nós que foram desempilhados e processados
-    int soma_ramificacao = 0;
-    int total_nos = 0;
+int ModeloCusto::custoMinimo() const {
+    int c = std::min(deslizar, pulo);
+    if (!posicao.empty()) c += *std::min_element(posicao.begin(), posicao.end());
+    return std::max(0, c);
+}
 
-    pilha.push(Estado(tabuleiroInicial, {}, 0));
+int ModeloCusto::custoMaximo() const {
+    int c = std::max(deslizar, pulo);
+    if (!posicao.empty()) c += *std::max_element(posicao.begin(), posicao.end());
+    return std::max(0, c);
+}
 
-    while (!pilha.empty()) {
-        if (estourouTimeout(start, timeout)) break;
+bool ModeloCusto::unitario() const {
+    if (deslizar != 1 || pulo != 1) return false;
+    for (int p : posicao) {
+        if (p != 0) return false;
+    }
+    return true;
+}
 
-        Estado atual = pilha.top();
-        pilha.pop();
-        std::string tabStr = tabuleiroParaString(atual.tabuleiro);
+int Solver::custoCaminho(const CaminhoCompacto& caminho, const ModeloCusto& custos) {
+    int total = 0;
+    for (const CaminhoCompacto::Passo& passo : caminho) {
+        total += custos.custo(passo.posicao, passo.vazio);
+    }
+    return total;
+}
 
-        // Marcar como visitado ao processar o nó
-        if (visitados.find(tabStr) != visitados.end()) continue;
-        visitados.insert(tabStr);
-        nos_visitados++;
+// Operacoes especializadas para N fichas de cada cor
+typedef SolverStats (*FuncaoResolver)(const std::vector<char>&, int, int, const OpcoesSolver&);
+typedef void (*FuncaoOtimizar)(const std::vector<char>&, SolverStats&, double);
+typedef EspacoBusca* (*FuncaoCriarEspaco)(size_t);
+
+struct EntradaDespacho {
+    FuncaoResolver resolver;
+    FuncaoOtimizar otimizar;
+    FuncaoCriarEspaco criarEspaco;
+};
+
+#define ENTRADA_FIXA(N) { &Buscas< NucleoFixo<N> >::resolver, &Buscas< NucleoFixo<N> >::otimizar, \
+                          &Buscas< NucleoFixo<N> >::criarEspaco }
+
+// Tabela de despacho indexada pelo numero de fichas de cada cor (2..32)
+const int MIN_FICHAS_FIXO = 2;
+const int MAX_FICHAS_FIXO = 32;
+const EntradaDespacho TABELA_DESPACHO[MAX_FICHAS_FIXO - MIN_FICHAS_FIXO + 1] = {
+    ENTRADA_FIXA(2),
+    ENTRADA_FIXA(3),
+    ENTRADA_FIXA(4),
+    ENTRADA_FIXA(5),
+    ENTRADA_FIXA(6),
+    ENTRADA_FIXA(7),
+    ENTRADA_FIXA(8),
+    ENTRADA_FIXA(9),
+    ENTRADA_FIXA(10),
+    ENTRADA_FIXA(11),
+    ENTRADA_FIXA(12),
+    ENTRADA_FIXA(13),
+    ENTRADA_FIXA(14),
+    ENTRADA_FIXA(15),
+    ENTRADA_FIXA(16),
+    ENTRADA_FIXA(17),
+    ENTRADA_FIXA(18),
+    ENTRADA_FIXA(19),
+    ENTRADA_FIXA(20),
+    ENTRADA_FIXA(21),
+    ENTRADA_FIXA(22),
+    ENTRADA_FIXA(23),
+    ENTRADA_FIXA(24),
+    ENTRADA_FIXA(25),
+    ENTRADA_FIXA(26),
+    ENTRADA_FIXA(27),
+    ENTRADA_FIXA(28),
+    ENTRADA_FIXA(29),
+    ENTRADA_FIXA(30),
+    ENTRADA_FIXA(31),
+    ENTRADA_FIXA(32),
+};
+
+#undef ENTRADA_FIXA
+
+const EntradaDespacho DESPACHO_DINAMICO = { &Buscas<NucleoDinamico>::resolver, &Buscas<NucleoDinamico>::otimizar,
+                                            &Buscas<NucleoDinamico>::criarEspaco };
+
+// Confere se o tabuleiro tem o formato padrao: N fichas 'A', N fichas 'B' e um vazio
+bool tabuleiroPadrao(const char* tabuleiro, size_t tamanho, int& numFichas) {
+    int numA = 0, numB = 0, numVazio = 0;
+    for (size_t i = 0; i < tamanho; ++i) {
+        char c = tabuleiro[i];
+        if (c == 'A') numA++;
+        else if (c == 'B') numB++;
+        else if (c == '_') numVazio++;
+        else return false;
+    }
+    numFichas = numB;
+    return numA == numB && numVazio == 1;
+}
 
-        if (verificarVitoria(atual.tabuleiro)) {
-            stats.caminho = atual.movimentos;
-            stats.profundidade = atual.profundidade;
-            stats.custo = static_cast<int>(atual.movimentos.size());
-            break;
-        }
+// Escolhe a versao especializada para o tamanho do tabuleiro, ou a generica
+const EntradaDespacho& despachar(const char* tabuleiro, size_t tamanho) {
+    int numFichas = 0;
+    if (tabuleiroPadrao(tabuleiro, tamanho, numFichas) &&
+        numFichas >= MIN_FICHAS_FIXO && numFichas <= MAX_FICHAS_FIXO) {
+        return TABELA_DESPACHO[numFichas - MIN_FICHAS_FIXO];
+    }
+    return DESPACHO_DINAMICO;
+}
 
-        std::vector<int> movimentosPossiveis = encontrarMovimentosPossiveis(atual.tabuleiro);
-        soma_ramificacao += movimentosPossiveis.size();
-        total_nos++;
-        nos_expandidos++; // Agora sim: esse nó gerou filhos
+const EntradaDespacho& despachar(const std::vector<char>& tabuleiro) {
+    return despachar(tabuleiro.data(), tabuleiro.size());
+}
 
-        std::reverse(movimentosPossiveis.begin(), movimentosPossiveis.end());
+// Tempo de CPU gasto pela thread atual, em segundos. Diferente do relogio de
+// parede, nao conta o tempo em que a thread esperou por um nucleo livre.
+double tempoCpuThread() {
+#if defined(_WIN32)
+    FILETIME criacao, saida, kernel, usuario;
+    if (!GetThreadTimes(GetCurrentThread(), &criacao, &saida, &kernel, &usuario)) return 0.0;
+    ULARGE_INTEGER k, u;
+    k.LowPart = kernel.dwLowDateTime;
+    k.HighPart = kernel.dwHighDateTime;
+    u.LowPart = usuario.dwLowDateTime;
+    u.HighPart = usuario.dwHighDateTime;
+    return (double)(k.QuadPart + u.QuadPart) * 1e-7;
+#else
+    timespec t;
+    if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &t) != 0) return 0.0;
+    return (double)t.tv_sec + (double)t.tv_nsec * 1e-9;
+#endif
+}
 
-        for (int movimento : movimentosPossiveis) {
-            std::vector<char> novoTabuleiro = aplicarMovimento(atual.tabuleiro, movimento);
-            std::string novoTabuleiroStr = tabuleiroParaString(novoTabuleiro);
+// Funcao principal que escolhe o algoritmo
+SolverStats Solver::resolver(const std::vector<char>& tabuleiroInicial, int algoritmo, int heuristica) {
+    return resolver(tabuleiroInicial, algoritmo, heuristica, OpcoesSolver());
+}
 
-            if (visitados.find(novoTabuleiroStr) == visitados.end()) {
-                std::vector<int> novosMovimentos = atual.movimentos;
-                novosMovimentos.push_back(movimento);
-                pilha.push(Estado(novoTabuleiro, novosMovimentos, atual.profundidade + 1));
-            }
-        }
+SolverStats Solver::resolver(const std::vector<char>& tabuleiroInicial, int algoritmo, int heuristica,
+                             const OpcoesSolver& opcoes) {
+    TrechoRastreio trecho("resolver", "solver", algoritmo);
+    double cpuInicio = tempoCpuThread();
+    SolverStats stats = algoritmo == 10 ? resolverConstrutivo(tabuleiroInicial)
+                                         : despachar(tabuleiroInicial).resolver(tabuleiroInicial, algoritmo, heuristica, opcoes);
+    stats.tempo_cpu = tempoCpuThread() - cpuInicio;
+    // O custo informado segue o modelo de custo, qualquer que seja o algoritmo
+    if (stats.profundidade >= 0 && !opcoes.custos.unitario()) {
+        stats.custo = custoCaminho(stats.caminho, opcoes.custos);
     }
+    return stats;
+}
 
+// Pos-otimizacao: remove ciclos e encurta trechos com buscas bidirecionais limitadas
+void Solver::otimizarCaminho(const std::vector<char>& tabuleiroInicial, SolverStats& stats, double orcamento) {
+    TrechoRastreio trecho("otimizarCaminho", "solver", (long long)stats.caminho.size());
+    auto start = std::chrono::high_resolution_clock::now();
+    double cpuInicio = tempoCpuThread();
+    despachar(tabuleiroInicial).otimizar(tabuleiroInicial, stats, orcamento);
     auto end = std::chrono::high_resolution_clock::now();
+    stats.tempo_execucao += std::chrono::duration<double>(end - start).count();
+    stats.tempo_cpu += tempoCpuThread() - cpuInicio;
+}
 
-    if (stats.caminho.empty()) {
-        stats.profundidade = -1;
-        stats.custo = -1;
-    }
+void Solver::mostrarSolucao(const std::vector<char>& tabuleiroInicial, const SolverStats& stats) {
+    mostrarSolucao(tabuleiroInicial, stats, DETALHE_COMPLETO, std::cout);
+}
 
-    stats.nos_expandidos = nos_expandidos;
-    stats.nos_visitados = nos_visitados;
-    stats.fator_ramificacao = total_nos > 0 ? static_cast<double>(soma_ramificacao) / total_nos : 0.0;
-    stats.tempo_execucao = std::chrono::duration<double>(end - start).count();
+void Solver::mostrarSolucao(const std::vector<char>& tabuleiroInicial, const SolverStats& stats,
+                            NivelDetalhe nivel, std::ostream& saida) {
+    RenderizadorSolucao renderizador(saida, nivel);
+    renderizador.renderizar(tabuleiroInicial, stats.caminho, stats);
+}
 
-    return stats;
+bool Solver::salvarSolucao(const std::vector<char>& tabuleiroInicial, const SolverStats& stats,
+                           NivelDetalhe nivel, const std::string& arquivo) {
+    std::ofstream saida(arquivo.c_str(), std::ios::out | std::ios::trunc);
+    if (!saida) return false;
+    mostrarSolucao(tabuleiroInicial, stats, nivel, saida);
+    return (bool)saida;
 }
 
+// --- SolverWorkspace ---
 
-// Funcao principal que escolhe o algoritmo
-SolverStats Solver::resolver(const std::vector<char>& tabuleiroInicial, int algoritmo, int heuristica) {
-    switch (algoritmo) {
-        case 1: return resolverBFS(tabuleiroInicial);
-        case 2: return resolverBacktracking(tabuleiroInicial, TIMEOUT_PADRAO);
-        case 3: return resolverDFS(tabuleiroInicial, TIMEOUT_PADRAO);
-        case 4: return resolverOrdenada(tabuleiroInicial);
-        case 5: return resolverGulosa(tabuleiroInicial, heuristica);
-        case 6: return resolverAStar(tabuleiroInicial, heuristica);
-        case 7: return resolverIDAStar(tabuleiroInicial, heuristica);
-        default: return resolverBFS(tabuleiroInicial);
-    }
+SolverWorkspace::SolverWorkspace() : despacho(nullptr), tamanhoAtual(0) {}
+
+SolverWorkspace::SolverWorkspace(int numFichas) : despacho(nullptr), tamanhoAtual(0) {
+    preparar(numFichas);
 }
 
-void Solver::mostrarSolucao(const std::vector<char>& tabuleiroInicial, const SolverStats& stats) {
-    if (stats.caminho.empty()) {
-        std::cout << "Nenhuma solucao encontrada!\n";
-        return;
+SolverWorkspace::~SolverWorkspace() {}
+
+void SolverWorkspace::preparar(int numFichas) {
+    std::vector<char> objetivo(numFichas, 'B');
+    objetivo.push_back('_');
+    objetivo.insert(objetivo.end(), numFichas, 'A');
+    espacoPara(objetivo.data(), objetivo.size());
+}
+
+// Refaz o espaco so quando o tamanho (ou a versao do solucionador) muda.
+// As estruturas retidas nao podem pertencer a arena de uma busca em curso.
+EspacoBusca* SolverWorkspace::espacoPara(const char* tabuleiro, size_t tamanho) {
+    const EntradaDespacho* entrada = &despachar(tabuleiro, tamanho);
+    if (!espaco || entrada != despacho || tamanho != tamanhoAtual) {
+        EscopoArena semArena(nullptr);
+        espaco.reset();
+        espaco.reset(entrada->criarEspaco(tamanho));
+        despacho = entrada;
+        tamanhoAtual = tamanho;
     }
-    std::vector<char> tabuleiroAtual = tabuleiroInicial;
-    std::cout << "Estado inicial:\n";
-    std::cout << "+";
-    for (int i = 0; i < (int)tabuleiroAtual.size(); ++i) std::cout << "-+";
-    std::cout << "\n|";
-    for (char c : tabuleiroAtual) std::cout << c << "|";
-    std::cout << "\n+";
-    for (int i = 0; i < (int)tabuleiroAtual.size(); ++i) std::cout << "-+";
-    std::cout << "\n ";
-    for (int i = 0; i < (int)tabuleiroAtual.size(); ++i) std::cout << i << " ";
-    std::cout << "\n\n";
-    for (int i = 0; i < (int)stats.caminho.size(); i++) {
-        int movimento = stats.caminho[i];
-        tabuleiroAtual = aplicarMovimento(tabuleiroAtual, movimento);
-        std::cout << "Movimento " << (i + 1) << " (posicao " << movimento << "):\n";
-        std::cout << "+";
-        for (int j = 0; j < (int)tabuleiroAtual.size(); ++j) std::cout << "-+";
-        std::cout << "\n|";
-        for (char c : tabuleiroAtual) std::cout << c << "|";
-        std::cout << "\n+";
-        for (int j = 0; j < (int)tabuleiroAtual.size(); ++j) std::cout << "-+";
-        std::cout << "\n ";
-        for (int j = 0; j < (int)tabuleiroAtual.size(); ++j) std::cout << j << " ";
-        std::cout << "\n\n";
+    return espaco.get();
+}
+
+SolverStats SolverWorkspace::resolver(const char* tabuleiro, size_t tamanho, int algoritmo, int heuristica,
+                                      const OpcoesSolver& opcoes) {
+    TrechoRastreio trecho("resolver", "solver", algoritmo);
+    // A construtiva e o custo por modelo trabalham sobre std::vector<char>
+    if (algoritmo == 10) return Solver::resolver(std::vector<char>(tabuleiro, tabuleiro + tamanho), algoritmo,
+                                                 heuristica, opcoes);
+    double cpuInicio = tempoCpuThread();
+    SolverStats stats = espacoPara(tabuleiro, tamanho)->resolver(tabuleiro, tamanho, algoritmo, heuristica, opcoes);
+    stats.tempo_cpu = tempoCpuThread() - cpuInicio;
+    if (stats.profundidade >= 0 && !opcoes.custos.unitario()) {
+        stats.custo = Solver::custoCaminho(stats.caminho, opcoes.custos);
     }
-    std::cout << "Solucao completa!\n";
-    std::cout << "\n=== ESTATISTICAS ===\n";
-    std::cout << "Numero de movimentos: " << stats.caminho.size() << "\n";
-    std::cout << "Profundidade da solucao: " << stats.profundidade << "\n";
-    std::cout << "Custo da solucao: " << stats.custo << "\n";
-    std::cout << "Nos expandidos: " << stats.nos_expandidos << "\n";
-    std::cout << "Nos visitados: " << stats.nos_visitados << "\n";
-    std::cout << "Fator medio de ramificacao: " << stats.fator_ramificacao << "\n";
-    std::cout << "Tempo de execucao: " << stats.tempo_execucao << " segundos\n\n";
+    return stats;
 }
 
+SolverStats SolverWorkspace::resolver(const std::vector<char>& tabuleiro, int algoritmo, int heuristica,
+                                      const OpcoesSolver& opcoes) {
+    return resolver(tabuleiro.data(), tabuleiro.size(), algoritmo, heuristica, opcoes);
+}
@@ -8,36 +8,127 @@
 #include <string>
 #include <chrono>
 #include <functional>
+#include <ostream>
+#include <memory>
+#include "Caminho.h"
+
+// Contadores de uma camada da busca (ver SolverStats::tipo_camada)
+struct CamadaBusca {
+    int camada = 0;
+    long long gerados = 0;             // filhos gerados pelos nos expandidos
+    long long expandidos = 0;
+    long long duplicados = 0;          // filhos descartados por ja terem sido vistos
+    double ramificacao = 0.0;          // gerados / expandidos
+    double ramificacao_efetiva = 0.0;  // expandidos da camada seguinte / expandidos desta
+};
 
 struct SolverStats {
-    std::vector<int> caminho;
+    CaminhoCompacto caminho;     // 2 bits por movimento (paraCaminho() da as posicoes)
     int profundidade = 0;
     int custo = 0;
-    int nos_expandidos = 0;
-    int nos_visitados = 0;
+    long long nos_expandidos = 0;
+    long long nos_visitados = 0;
     double fator_ramificacao = 0.0;
     double tempo_execucao = 0.0; // em segundos
+    double tempo_cpu = 0.0;      // CPU da thread que resolveu, em segundos (sem as threads do feixe paralelo)
+    double limite_subotimalidade = 0.0; // ARA*: custo <= limite * custo otimo (1.0 = otimo provado)
+    // A*: expansoes com f igual ao custo da solucao (a unica camada que o desempate muda)
+    long long expandidos_ultima_camada = 0;
+    long long nos_reabertos = 0;        // A*: estados expandidos que voltaram para a lista aberta
+    long long pico_nos = 0;             // BFS e A*: maior numero de estados guardados ao mesmo tempo
+    long long movimentos_podados = 0;   // IDA* e Backtracking: filhos descartados pelo automato de poda
+    long long estados_perimetro = 0;    // IDA* e A*: estados no perimetro em volta dos objetivos
+    bool memoria_esgotada = false;      // parou por OpcoesSolver::limite_memoria
+
+    // Arena da busca (OpcoesSolver::arena): pedidos atendidos, bytes pedidos
+    // e maior quantidade de bytes que a arena chegou a pegar do sistema
+    long long arena_alocacoes = 0;
+    long long arena_bytes_pedidos = 0;
+    long long arena_pico_bytes = 0;
+    int arena_blocos = 0;
+
+    // Histograma por camada (so com OpcoesSolver::histograma): profundidade,
+    // custo g (UCS), valor f (A*) ou iteracao do IDA* (limite de f)
+    std::string tipo_camada;
+    std::vector<CamadaBusca> camadas;
+};
+
+// Custo dos movimentos. Por padrao todo movimento custa 1.
+struct ModeloCusto {
+    int deslizar = 1;             // ficha vizinha ao vazio
+    int pulo = 1;                 // ficha pula outra para chegar ao vazio
+    std::vector<int> posicao;     // opcional: custo adicional de mover a ficha da posicao i
+
+    int custo(int origem, int vazio) const;
+    int custoMinimo() const;      // menor custo de um movimento qualquer
+    int custoMaximo() const;      // maior custo de um movimento qualquer
+    bool unitario() const;        // todo movimento custa 1
+};
+
+// Desempate entre estados com a mesma prioridade (f no A*, h na Gulosa)
+enum PoliticaDesempate {
+    DESEMPATE_QUALQUER = 0,  // sem chave secundaria: a ordem em que o heap os deixar
+    DESEMPATE_MAIOR_G = 1,   // mais fundo primeiro
+    DESEMPATE_MENOR_H = 2,   // mais perto do objetivo primeiro (no A*, com f igual, equivale a MAIOR_G)
+    DESEMPATE_LIFO = 3,      // o inserido por ultimo primeiro
+    DESEMPATE_ALEATORIO = 4  // ordem pseudoaleatoria reproduzivel (semente_desempate)
+};
+
+// Opcoes adicionais dos algoritmos
+struct OpcoesSolver {
+    // Custo dos movimentos (Busca Ordenada e A*; tambem define SolverStats::custo)
+    ModeloCusto custos;
+
+    // Preenche SolverStats::camadas (todos os algoritmos de busca)
+    bool histograma = false;
+
+    // Nos, filas e tabelas de visitados numa arena liberada de uma vez no fim
+    // da busca (todos os algoritmos de busca)
+    bool arena = true;
+    // Teto em bytes para a arena (0 = sem teto). BFS, DFS, Busca Ordenada,
+    // Gulosa, A*, ARA* e a busca de fronteira param ao passar dele, como num
+    // timeout. Num SolverWorkspace as estruturas retidas ficam fora da arena.
+    size_t limite_memoria = 0;
+
+    // BFS e A*: busca de fronteira, sem lista de fechados (usa o prazo abaixo).
+    // Ignorada no A* se algum movimento custar 0 (custos.custoMinimo() == 0):
+    // os trechos da reconstrucao do caminho poderiam nao encurtar, entao
+    // roda o A* comum.
+    bool fronteira = false;
+
+    // IDA* e Backtracking: o automato de poda (AutomatoPoda.h) descarta
+    // sequencias de movimentos redundantes sem consultar hash; o conjunto com
+    // os estados do caminho atual pega os ciclos mais longos que ele
+    bool poda_automato = true;
+    bool poda_caminho = true;     // sem o automato fica sempre ligado
+
+    // IDA* e A*: distancias exatas ate 'raio_perimetro' movimentos dos
+    // objetivos, calculadas uma vez por tamanho de regua e raio e reusadas
+    // pelas buscas seguintes (0 = desligado; no A*, so com custo unitario)
+    int raio_perimetro = 0;
+
+    // Gulosa e A*
+    PoliticaDesempate desempate = DESEMPATE_QUALQUER;
+    unsigned long long semente_desempate = 1;
+
+    // A* anytime (ARA*) e busca em feixe
+    double prazo = 10.0;           // tempo maximo em segundos
+    double peso_inicial = 3.0;     // peso da heuristica na primeira iteracao
+    double decremento_peso = 0.5;  // reducao do peso a cada iteracao
+    // Chamado a cada solucao melhorada (com o limite de subotimalidade atual)
+    std::function<void(const SolverStats&)> aoMelhorarSolucao;
+
+    // Busca em feixe (o prazo acima tambem vale para ela)
+    int largura_feixe = 100;       // estados mantidos por camada
+    int janela_feixe = 32;         // camadas recentes consultadas para descartar estados repetidos
+    bool feixe_paralelo = false;   // expande o feixe em varias threads
+    int threads = 0;               // 0 = std::thread::hardware_concurrency()
 };
 
 class Solver {
 public:
     // Nenhum método público
 private:
-    struct Estado {
-        std::vector<char> tabuleiro;
-        std::vector<int> movimentos;
-        int profundidade;
-        int custo_g; // custo acumulado (para UCS e A*)
-        int custo_h; // heuristica (para A* e Gulosa)
-        Estado* pai; // para IDA*
-        
-        Estado(const std::vector<char>& tab, const std::vector<int>& movs, int prof)
-            : tabuleiro(tab), movimentos(movs), profundidade(prof), custo_g(0), custo_h(0), pai(nullptr) {}
-        
-        Estado(const std::vector<char>& tab, const std::vector<int>& movs, int prof, int g, int h)
-            : tabuleiro(tab), movimentos(movs), profundidade(prof), custo_g(g), custo_h(h), pai(nullptr) {}
-    };
-    
     static std::string tabuleiroParaString(const std::vector<char>& tabuleiro);
     static std::vector<char> stringParaTabuleiro(const std::string& str);
     static std::vector<int> encontrarMovimentosPossiveis(const std::vector<char>& tabuleiro);
@@ -48,31 +139,71 @@ private:
     // Heuristicas
     static int heuristicaManhattan(const std::vector<char>& tabuleiro);
     static int heuristicaFichasForaDoLugar(const std::vector<char>& tabuleiro);
+    static int heuristicaInversoes(const std::vector<char>& tabuleiro);
 
 
     
-    // Algoritmos de busca
-    static SolverStats resolverBFS(const std::vector<char>& tabuleiroInicial);
-    static SolverStats resolverBacktracking(const std::vector<char>& tabuleiroInicial, double timeout = 10.0);
-    static SolverStats resolverDFS(const std::vector<char>& tabuleiroInicial, double timeout = 10.0);
-    static SolverStats resolverOrdenada(const std::vector<char>& tabuleiroInicial);
-    static SolverStats resolverGulosa(const std::vector<char>& tabuleiroInicial, int heuristica);
-    static SolverStats resolverAStar(const std::vector<char>& tabuleiroInicial, int heuristica); 
-    static SolverStats resolverIDAStar(const std::vector<char>& tabuleiroInicial, int heuristica); 
-    
-    // Funcoes auxiliares
-    static bool dfsLimitadoRecursivo(const std::vector<char>& tabuleiro, std::vector<int>& caminho, 
-                                   std::unordered_set<std::string>& visitados, int limite, int profundidade,
-                                   int& nos_expandidos, int& nos_visitados);
-
-    static int calcularCusto(const std::vector<char>& tabuleiro);
-    static int heuristica(const std::vector<char>& tabuleiro, int tipo);
     static int calcularNumFichas(const std::vector<char>& tabuleiro);
     static std::vector<char> gerarEstadoFinal(const std::vector<char>& tabuleiro);
 
+    static SolverStats resolverConstrutivo(const std::vector<char>& tabuleiroInicial);
+    static int custoCaminho(const CaminhoCompacto& caminho, const ModeloCusto& custos);
+
+    // Os algoritmos de busca ficam em SolverNucleo.h
+    friend struct NucleoDinamico;
+    friend class MotorDicas;
+    friend class SolverWorkspace;
+
 public:
+    // Valor da heuristica 'tipo' (1 = Manhattan, 2 = fichas fora do lugar, 3 = inversoes)
+    static int heuristica(const std::vector<char>& tabuleiro, int tipo);
     static SolverStats resolver(const std::vector<char>& tabuleiroInicial, int algoritmo = 1, int heuristica = 1);
+    static SolverStats resolver(const std::vector<char>& tabuleiroInicial, int algoritmo, int heuristica,
+                                const OpcoesSolver& opcoes);
+    // Solucao construtiva em O(n^2), entregue movimento a movimento (sem materializar o caminho).
+    // Tambem serve de limite superior para as buscas. Retorna o numero de movimentos ou -1.
+    static long long construirSolucao(const std::vector<char>& tabuleiroInicial, const std::function<void(int)>& emitir);
+    // Pos-processamento opcional para caminhos nao otimos (orcamento em segundos)
+    static void otimizarCaminho(const std::vector<char>& tabuleiroInicial, SolverStats& stats, double orcamento = 1.0);
     static void mostrarSolucao(const std::vector<char>& tabuleiroInicial, const SolverStats& stats);
+    static void mostrarSolucao(const std::vector<char>& tabuleiroInicial, const SolverStats& stats,
+                               NivelDetalhe nivel, std::ostream& saida);
+    static bool salvarSolucao(const std::vector<char>& tabuleiroInicial, const SolverStats& stats,
+                              NivelDetalhe nivel, const std::string& arquivo);
+};
+
+// Resolve muitos tabuleiros seguidos sem montar e desmontar as estruturas a
+// cada busca: os nos, os visitados, a lista aberta e a arena da busca ficam
+// com a capacidade que ja tinham e so os conteudos sao limpos. As tabelas que
+// dependem do tamanho da regua (capacidades, despacho, perimetro) sao
+// preparadas uma vez e refeitas apenas quando o tamanho muda. O tabuleiro
+// pode vir de qualquer memoria (ponteiro + tamanho). Nao e sincronizado: use
+// um workspace por thread.
+class EspacoBusca;
+struct EntradaDespacho;
+
+class SolverWorkspace {
+public:
+    SolverWorkspace();
+    explicit SolverWorkspace(int numFichas);  // ja prepara as tabelas para 'numFichas' de cada cor
+    ~SolverWorkspace();
+
+    void preparar(int numFichas);
+
+    SolverStats resolver(const char* tabuleiro, size_t tamanho, int algoritmo, int heuristica,
+                         const OpcoesSolver& opcoes = OpcoesSolver());
+    SolverStats resolver(const std::vector<char>& tabuleiro, int algoritmo, int heuristica,
+                         const OpcoesSolver& opcoes = OpcoesSolver());
+
+private:
+    SolverWorkspace(const SolverWorkspace&);
+    SolverWorkspace& operator=(const SolverWorkspace&);
+
+    EspacoBusca* espacoPara(const char* tabuleiro, size_t tamanho);
+
+    std::unique_ptr<EspacoBusca> espaco;
+    const EntradaDespacho* despacho;  // versao do solucionador do espaco atual
+    size_t tamanhoAtual;
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,2252 @@
+#ifndef SOLVER_NUCLEO_H
+#define SOLVER_NUCLEO_H
+
+// Nucleo templatizado do solucionador.
+//
+// Os algoritmos de busca sao escritos uma unica vez em Buscas<Nucleo>, onde o
+// Nucleo define a representacao do tabuleiro e as operacoes basicas
+// (movimentos, vitoria, heuristicas, chave para o conjunto de visitados).
+//
+// - NucleoFixo<N>: especializado em tempo de compilacao para N fichas de cada
+//   cor (2 <= N <= 32). O tabuleiro cabe em uma palavra de 64 bits (mascara
+//   das fichas 'B' na ordem em que aparecem, ignorando o vazio) mais a posicao
+//   do vazio, e a tabela de movimentos e constexpr.
+// - NucleoDinamico: usa std::vector<char> de tamanho em tempo de execucao e
+//   serve de fallback para tabuleiros maiores ou fora do formato padrao.
+//
+// Alem das heuristicas selecionaveis, cada Nucleo fornece limiteInferior(),
+// uma estimativa admissivel (numero de inversoes) usada para provar limites
+// de subotimalidade.
+//
+// Este cabecalho e de uso interno de Solver.cpp.
+
+#include "Solver.h"
+#include "TabelaHash.h"
+#include "HeapIndexado.h"
+#include "Arena.h"
+#include "AutomatoPoda.h"
+#include "Rastreio.h"
+#include <vector>
+#include <queue>
+#include <string>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstdint>
+#include <thread>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+
+// --- Timeout padrão para todos algoritmos (em segundos) ---
+const double TIMEOUT_PADRAO = 10.0;
+
+// --- Função auxiliar para checar timeout ---
+inline bool estourouTimeout(const std::chrono::high_resolution_clock::time_point& start, double timeout) {
+    auto now = std::chrono::high_resolution_clock::now();
+    double elapsed = std::chrono::duration<double>(now - start).count();
+    return elapsed > timeout;
+}
+
+// Mistura de bits (finalizador do splitmix64) usada nos hashes das chaves
+inline uint64_t misturarHash(uint64_t x) {
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebULL;
+    x ^= x >> 31;
+    return x;
+}
+
+// Numero de estados da regua com n fichas de cada cor: (2n+1)! / (n! n!),
+// saturado em 'limite'. Usado para dimensionar os conjuntos de visitados.
+inline size_t tamanhoEspacoEstados(int numFichas, size_t limite) {
+    // (2n+1)!/(n! n!) = (n+1) * C(2n+1, n), calculado termo a termo
+    double estados = numFichas + 1.0;
+    for (int i = 1; i <= numFichas && estados < (double)limite; ++i) {
+        estados = estados * (numFichas + 1 + i) / i;
+    }
+    return estados < (double)limite ? (size_t)(estados + 0.5) : limite;
+}
+
+// Hash para chaves que ja sao hashes de 64 bits bem misturados
+struct HashIdentidade {
+    size_t operator()(uint64_t x) const { return (size_t)x; }
+};
+
+// --- Sequencia de indices em tempo de compilacao (C++11 nao tem index_sequence) ---
+template <int... Is> struct Indices {};
+template <int K, int... Is> struct GerarIndices : GerarIndices<K - 1, K - 1, Is...> {};
+template <int... Is> struct GerarIndices<0, Is...> { typedef Indices<Is...> tipo; };
+
+// Destinos possiveis do vazio (na mesma ordem de Solver::encontrarMovimentosPossiveis):
+// deslizar esquerda, deslizar direita, pulo esquerda, pulo direita. -1 = inexistente.
+struct MovimentosVazio {
+    int posicoes[4];
+};
+
+constexpr MovimentosVazio movimentosDoVazio(int v, int tamanho) {
+    return MovimentosVazio{{ v > 0 ? v - 1 : -1,
+                             v < tamanho - 1 ? v + 1 : -1,
+                             v > 1 ? v - 2 : -1,
+                             v < tamanho - 2 ? v + 2 : -1 }};
+}
+
+template <int T>
+struct TabelaMovimentos {
+    MovimentosVazio vazio[T];
+};
+
+template <int T, int... Is>
+constexpr TabelaMovimentos<T> construirTabelaMovimentos(Indices<Is...>) {
+    return TabelaMovimentos<T>{{ movimentosDoVazio(Is, T)... }};
+}
+
+// ---------------------------------------------------------------------------
+// Nucleo especializado para N fichas de cada cor
+// ---------------------------------------------------------------------------
+template <int N>
+struct NucleoFixo {
+    static_assert(N >= 1 && N <= 32, "a mascara de fichas precisa caber em 64 bits");
+    static const int TAMANHO = 2 * N + 1;
+
+    // Bit i da mascara = 1 se a i-esima ficha (da esquerda para a direita,
+    // ignorando o vazio) e 'B'. A ficha de indice i ocupa a celula i se estiver
+    // a esquerda do vazio e a celula i + 1 caso contrario.
+    struct Tabuleiro {
+        uint64_t mascara;
+        int vazio;
+        bool operator==(const Tabuleiro& outro) const {
+            return mascara == outro.mascara && vazio == outro.vazio;
+        }
+    };
+    typedef Tabuleiro Chave;
+
+    struct HashChave {
+        size_t operator()(const Chave& c) const {
+            return (size_t)misturarHash(c.mascara ^ misturarHash((uint64_t)c.vazio + 1));
+        }
+    };
+
+    static constexpr TabelaMovimentos<TAMANHO> TABELA =
+        construirTabelaMovimentos<TAMANHO>(typename GerarIndices<TAMANHO>::tipo());
+
+    static constexpr uint64_t MASCARA_OBJETIVO = (1ULL << N) - 1;
+
+    static bool tabuleiroValido(const std::vector<char>& tab) {
+        if ((int)tab.size() != TAMANHO) return false;
+        int numA = 0, numB = 0, numVazio = 0;
+        for (char c : tab) {
+            if (c == 'A') numA++;
+            else if (c == 'B') numB++;
+            else if (c == '_') numVazio++;
+            else return false;
+        }
+        return numA == N && numB == N && numVazio == 1;
+    }
+
+    static Tabuleiro deVetor(const std::vector<char>& tab) { return deCelulas(tab.data(), tab.size()); }
+
+    // 'tamanho' deve ser TAMANHO (ver tabuleiroValido)
+    static Tabuleiro deCelulas(const char* tab, size_t /*tamanho*/) {
+        Tabuleiro t;
+        t.mascara = 0;
+        t.vazio = 0;
+        int ficha = 0;
+        for (int i = 0; i < TAMANHO; ++i) {
+            if (tab[i] == '_') {
+                t.vazio = i;
+            } else {
+                if (tab[i] == 'B') t.mascara |= (1ULL << ficha);
+                ficha++;
+            }
+        }
+        return t;
+    }
+
+    static std::vector<char> paraVetor(const Tabuleiro& t) {
+        std::vector<char> tab(TAMANHO);
+        for (int i = 0; i < TAMANHO; ++i) tab[i] = celula(t, i);
+        return tab;
+    }
+
+    static Chave chave(const Tabuleiro& t) { return t; }
+
+    static char celula(const Tabuleiro& t, int i) {
+        if (i == t.vazio) return '_';
+        int ficha = i - (i > t.vazio ? 1 : 0);
+        return ((t.mascara >> ficha) & 1ULL) ? 'B' : 'A';
+    }
+
+    static int encontrarEspacoVazio(const Tabuleiro& t) { return t.vazio; }
+
+    static int movimentos(const Tabuleiro& t, int destino[4]) {
+        const MovimentosVazio& m = TABELA.vazio[t.vazio];
+        int q = 0;
+        for (int k = 0; k < 4; ++k) {
+            if (m.posicoes[k] >= 0) destino[q++] = m.posicoes[k];
+        }
+        return q;
+    }
+
+    // Deslizar nao altera a ordem das fichas; um pulo troca duas fichas vizinhas
+    static Tabuleiro aplicarMovimento(const Tabuleiro& t, int posicao) {
+        Tabuleiro novo = t;
+        int v = t.vazio;
+        int i = -1;
+        if (posicao == v - 2) i = v - 2;
+        else if (posicao == v + 2) i = v;
+        if (i >= 0) {
+            uint64_t a = (t.mascara >> i) & 1ULL;
+            uint64_t b = (t.mascara >> (i + 1)) & 1ULL;
+            if (a != b) novo.mascara ^= (3ULL << i);
+        }
+        novo.vazio = posicao;
+        return novo;
+    }
+
+    static void aplicarNoLugar(Tabuleiro& t, int posicao, int /*vazio*/) { t = aplicarMovimento(t, posicao); }
+
+    static uint64_t hashTabuleiro(const Tabuleiro& t) { return HashChave()(t); }
+
+    static bool verificarVitoria(const Tabuleiro& t) {
+        return t.mascara == MASCARA_OBJETIVO;
+    }
+
+    static int heuristicaManhattan(const Tabuleiro& t) {
+        int custo = 0;
+        int posicaoIdealB = 0;
+        for (int i = 0; i < 2 * N; ++i) {
+            if ((t.mascara >> i) & 1ULL) {
+                int pos = i + (i >= t.vazio ? 1 : 0);
+                custo += std::abs(pos - posicaoIdealB);
+                posicaoIdealB++;
+            }
+        }
+        int posicaoIdealA = TAMANHO - 1;
+        for (int i = 2 * N - 1; i >= 0; --i) {
+            if (!((t.mascara >> i) & 1ULL)) {
+                int pos = i + (i >= t.vazio ? 1 : 0);
+                custo += std::abs(pos - posicaoIdealA);
+                posicaoIdealA--;
+            }
+        }
+        return custo;
+    }
+
+    static int heuristicaFichasForaDoLugar(const Tabuleiro& t) {
+        int fichasForaDoLugar = 0;
+        for (int i = 0; i < N; ++i) {
+            if (celula(t, i) != 'B') fichasForaDoLugar++;
+        }
+        for (int i = N + 1; i < TAMANHO; ++i) {
+            if (celula(t, i) != 'A') fichasForaDoLugar++;
+        }
+        return fichasForaDoLugar;
+    }
+
+    // Pares (A, B) com o A antes do B: para cada 'B', quantos 'A' vem antes
+    static int heuristicaInversoes(const Tabuleiro& t) {
+        int inversoes = 0;
+        int numA = 0;
+        for (int i = 0; i < 2 * N; ++i) {
+            if ((t.mascara >> i) & 1ULL) inversoes += numA;
+            else numA++;
+        }
+        return inversoes;
+    }
+
+    static int heuristica(const Tabuleiro& t, int tipo) {
+        switch (tipo) {
+            case 2: return heuristicaFichasForaDoLugar(t);
+            case 3: return heuristicaInversoes(t);
+            default: return heuristicaManhattan(t);
+        }
+    }
+
+    static int limiteInferior(const Tabuleiro& t) { return heuristicaInversoes(t); }
+
+    // Cota inferior dos movimentos entre dois tabuleiros: um pulo troca duas
+    // fichas vizinhas (muda no maximo 2 bits da mascara) e todo movimento leva
+    // o vazio no maximo 2 casas
+    static int distanciaMinima(const Tabuleiro& a, const Tabuleiro& b) {
+        int trocas = __builtin_popcountll(a.mascara ^ b.mascara) / 2;
+        int vazio = (std::abs(a.vazio - b.vazio) + 1) / 2;
+        return std::max(trocas, vazio);
+    }
+};
+
+template <int N>
+constexpr TabelaMovimentos<NucleoFixo<N>::TAMANHO> NucleoFixo<N>::TABELA;
+template <int N>
+constexpr uint64_t NucleoFixo<N>::MASCARA_OBJETIVO;
+
+// ---------------------------------------------------------------------------
+// Nucleo generico (qualquer tamanho de tabuleiro)
+// ---------------------------------------------------------------------------
+struct NucleoDinamico {
+    typedef std::vector<char> Tabuleiro;
+    typedef std::string Chave;
+
+    // FNV-1a + mistura: bits altos e baixos bons para a tabela plana
+    struct HashChave {
+        size_t operator()(const Chave& c) const {
+            uint64_t h = 1469598103934665603ULL;
+            for (char ch : c) {
+                h ^= (unsigned char)ch;
+                h *= 1099511628211ULL;
+            }
+            return (size_t)misturarHash(h);
+        }
+    };
+
+    static Tabuleiro deVetor(const std::vector<char>& tab) { return tab; }
+    static Tabuleiro deCelulas(const char* tab, size_t tamanho) { return Tabuleiro(tab, tab + tamanho); }
+    static std::vector<char> paraVetor(const Tabuleiro& t) { return t; }
+    static Chave chave(const Tabuleiro& t) { return Solver::tabuleiroParaString(t); }
+    static char celula(const Tabuleiro& t, int i) { return t[i]; }
+    static int encontrarEspacoVazio(const Tabuleiro& t) { return Solver::encontrarEspacoVazio(t); }
+
+    static int movimentos(const Tabuleiro& t, int destino[4]) {
+        std::vector<int> movs = Solver::encontrarMovimentosPossiveis(t);
+        for (size_t k = 0; k < movs.size(); ++k) destino[k] = movs[k];
+        return (int)movs.size();
+    }
+
+    static Tabuleiro aplicarMovimento(const Tabuleiro& t, int posicao) {
+        return Solver::aplicarMovimento(t, posicao);
+    }
+
+    // Troca a ficha com o vazio sem copiar o tabuleiro (movimento ja validado)
+    static void aplicarNoLugar(Tabuleiro& t, int posicao, int vazio) {
+        std::swap(t[posicao], t[vazio]);
+    }
+
+    // Hash de 64 bits do conteudo (FNV-1a), sem montar a chave em string
+    static uint64_t hashTabuleiro(const Tabuleiro& t) {
+        uint64_t h = 1469598103934665603ULL;
+        for (char c : t) {
+            h ^= (unsigned char)c;
+            h *= 1099511628211ULL;
+        }
+        return misturarHash(h);
+    }
+
+    static bool verificarVitoria(const Tabuleiro& t) { return Solver::verificarVitoria(t); }
+
+    static int heuristica(const Tabuleiro& t, int tipo) { return Solver::heuristica(t, tipo); }
+    static int limiteInferior(const Tabuleiro& t) { return Solver::heuristicaInversoes(t); }
+
+    // Mesma cota do NucleoFixo: fichas diferentes na sequencia sem o vazio / 2
+    // e a distancia do vazio / 2
+    static int distanciaMinima(const Tabuleiro& a, const Tabuleiro& b) {
+        int diferentes = 0;
+        size_t i = 0, j = 0;
+        while (i < a.size() && j < b.size()) {
+            if (a[i] == '_') { ++i; continue; }
+            if (b[j] == '_') { ++j; continue; }
+            if (a[i] != b[j]) diferentes++;
+            ++i;
+            ++j;
+        }
+        int vazio = (std::abs(encontrarEspacoVazio(a) - encontrarEspacoVazio(b)) + 1) / 2;
+        return std::max(diferentes / 2, vazio);
+    }
+};
+
+// Estado que um SolverWorkspace guarda para um tamanho de regua
+// (Buscas<Nucleo>::Espaco)
+class EspacoBusca {
+public:
+    virtual ~EspacoBusca() {}
+    virtual SolverStats resolver(const char* tabuleiro, size_t tamanho, int algoritmo, int heuristica,
+                                 const OpcoesSolver& opcoes) = 0;
+};
+
+// ---------------------------------------------------------------------------
+// Algoritmos de busca sobre um Nucleo
+// ---------------------------------------------------------------------------
+template <class Nucleo>
+struct Buscas {
+    typedef typename Nucleo::Tabuleiro Tabuleiro;
+    typedef typename Nucleo::Chave Chave;
+    // Conteineres da busca: usam a arena da busca atual (Arena.h), se houver
+    template <class T> using VetorArena = std::vector<T, AlocadorArena<T> >;
+    typedef ConjuntoPlano<Chave, typename Nucleo::HashChave, AlocadorArena<char> > ConjuntoChaves;
+    typedef MapaPlano<Chave, int, typename Nucleo::HashChave, AlocadorArena<char> > MapaIndices;
+    typedef HeapIndexado<4, AlocadorArena<char> > HeapAbertos;
+    typedef std::chrono::high_resolution_clock Relogio;
+
+    // Nos ficam num vetor e apontam para o pai por indice; o caminho so e
+    // reconstruido quando a solucao e encontrada.
+    struct No {
+        Tabuleiro tabuleiro;
+        int pai;
+        int movimento;
+        int profundidade;
+        int custo_g; // custo acumulado (para UCS e A*)
+        int custo_h; // heuristica (para A* e Gulosa)
+        bool fechado; // ja expandido (UCS, Gulosa e A*)
+    };
+
+    struct EntradaFila {
+        int prioridade;
+        int indice;
+    };
+
+    enum Ordem { ORDEM_HEURISTICA, ORDEM_A_ESTRELA };
+
+    // Conteineres reaproveitados entre buscas (definido depois do perimetro)
+    struct Estruturas;
+
+    // Filhos de uma expansao com chave e hash ja calculados. Os hashes de
+    // todos sao prebuscados na tabela antes da primeira consulta, para que
+    // as faltas de cache dos ate 4 filhos se sobreponham.
+    struct Filhos {
+        int q;
+        int movimentos[4];
+        Tabuleiro tabuleiros[4];
+        Chave chaves[4];
+        uint64_t hashes[4];
+    };
+
+    template <class Tabela>
+    static void gerarFilhos(const Tabuleiro& tab, const Tabela& tabela, Filhos& f) {
+        f.q = Nucleo::movimentos(tab, f.movimentos);
+        completarFilhos(tab, tabela, f);
+    }
+
+    template <class Tabela>
+    static void completarFilhos(const Tabuleiro& tab, const Tabela& tabela, Filhos& f) {
+        for (int k = 0; k < f.q; ++k) {
+            f.tabuleiros[k] = Nucleo::aplicarMovimento(tab, f.movimentos[k]);
+            f.chaves[k] = Nucleo::chave(f.tabuleiros[k]);
+            f.hashes[k] = tabela.hashDe(f.chaves[k]);
+            tabela.prebuscar(f.hashes[k]);
+        }
+    }
+
+    // Filhos cujo movimento o automato de poda aceita a partir de 'estado'
+    // (AutomatoPoda.h); 'proximos' recebe o estado do automato de cada filho.
+    // Devolve quantos movimentos foram podados. Sem 'tabela', as chaves e os
+    // hashes nao sao calculados.
+    template <class Tabela>
+    static int gerarFilhosPodados(const Tabuleiro& tab, int estado, const Tabela* tabela,
+                                  Filhos& f, int proximos[4]) {
+        int movimentos[4];
+        int q = Nucleo::movimentos(tab, movimentos);
+        int vazio = Nucleo::encontrarEspacoVazio(tab);
+        f.q = 0;
+        for (int k = 0; k < q; ++k) {
+            int proximo = AutomatoPoda::proximo(estado, vazio, movimentos[k]);
+            if (proximo == AutomatoPoda::PODADO) continue;
+            proximos[f.q] = proximo;
+            f.movimentos[f.q++] = movimentos[k];
+        }
+        if (tabela) {
+            completarFilhos(tab, *tabela, f);
+        } else {
+            for (int k = 0; k < f.q; ++k) f.tabuleiros[k] = Nucleo::aplicarMovimento(tab, f.movimentos[k]);
+        }
+        return q - f.q;
+    }
+
+    // Capacidade inicial dos visitados: o espaco de estados inteiro, ate um teto
+    static size_t capacidadeVisitados(const Tabuleiro& inicial) {
+        return capacidadeVisitados(Nucleo::paraVetor(inicial).size());
+    }
+
+    static size_t capacidadeVisitados(size_t tamanho) {
+        const size_t LIMITE_PRE_ALOCACAO = 1 << 18;
+        return tamanhoEspacoEstados(((int)tamanho - 1) / 2, LIMITE_PRE_ALOCACAO);
+    }
+
+    // A arena da busca passou de OpcoesSolver::limite_memoria?
+    static bool estourouMemoria(size_t limite) {
+        if (limite == 0) return false;
+        Arena* arena = Arena::atual();
+        return arena && (size_t)arena->bytesReservadosAgora() > limite;
+    }
+
+    static No criarNo(const Tabuleiro& tab, int pai, int movimento, int profundidade, int g, int h) {
+        No no = { tab, pai, movimento, profundidade, g, h, false };
+        return no;
+    }
+
+    static CaminhoCompacto reconstruirCaminho(const VetorArena<No>& nos, int indice) {
+        std::vector<int> caminho;
+        while (indice >= 0 && nos[indice].pai >= 0) {
+            caminho.push_back(nos[indice].movimento);
+            indice = nos[indice].pai;
+        }
+        std::reverse(caminho.begin(), caminho.end());
+        // 'indice' e a raiz: o caminho guardado comeca pelo vazio dela
+        return CaminhoCompacto::deCaminho(Nucleo::encontrarEspacoVazio(nos[indice].tabuleiro), caminho);
+    }
+
+    static void finalizar(SolverStats& stats, bool encontrou, long long nos_expandidos, long long nos_visitados,
+                          long long soma_ramificacao, long long total_nos, const Relogio::time_point& start) {
+        auto end = Relogio::now();
+        if (!encontrou) {
+            stats.caminho = CaminhoCompacto();
+            stats.profundidade = -1;
+            stats.custo = -1;
+        }
+        stats.nos_expandidos = nos_expandidos;
+        stats.nos_visitados = nos_visitados;
+        stats.fator_ramificacao = total_nos > 0 ? (double)soma_ramificacao / total_nos : 0.0;
+        stats.tempo_execucao = std::chrono::duration<double>(end - start).count();
+    }
+
+    // Histograma por camada. Desligado, cada registro custa apenas um teste.
+    class Histograma {
+    public:
+        explicit Histograma(bool ativo = false) : ativo(ativo) {}
+
+        void expandido(int camada, int gerados, int duplicados) {
+            somar(camada, 1, gerados, duplicados);
+        }
+
+        void somar(int camada, long long expandidos, long long gerados, long long duplicados) {
+            if (!ativo || camada < 0) return;
+            if ((size_t)camada >= camadas.size()) camadas.resize(camada + 1);
+            CamadaBusca& c = camadas[camada];
+            c.camada = camada;
+            c.expandidos += expandidos;
+            c.gerados += gerados;
+            c.duplicados += duplicados;
+        }
+
+        // So as camadas nao vazias; a ramificacao efetiva usa a proxima delas
+        void exportar(SolverStats& stats, const char* tipo) const {
+            if (!ativo) return;
+            stats.tipo_camada = tipo;
+            stats.camadas.clear();
+            for (size_t i = 0; i < camadas.size(); ++i) {
+                if (camadas[i].expandidos > 0 || camadas[i].gerados > 0) stats.camadas.push_back(camadas[i]);
+            }
+            for (size_t i = 0; i < stats.camadas.size(); ++i) {
+                CamadaBusca& c = stats.camadas[i];
+                if (c.expandidos == 0) continue;
+                c.ramificacao = (double)c.gerados / c.expandidos;
+                if (i + 1 < stats.camadas.size()) {
+                    c.ramificacao_efetiva = (double)stats.camadas[i + 1].expandidos / c.expandidos;
+                }
+            }
+        }
+
+    private:
+        bool ativo;
+        std::vector<CamadaBusca> camadas;
+    };
+
+    // BFS (Busca em Largura). Os nos entram no vetor na mesma ordem em que
+    // sairiam da fila, entao a fila e so um cursor sobre ele.
+    static SolverStats resolverBFS(const Tabuleiro& inicial, const OpcoesSolver& opcoes, Estruturas& e) {
+        SolverStats stats;
+        auto start = Relogio::now();
+        Histograma histograma(opcoes.histograma);
+        VetorArena<No>& nos = e.nos;
+        ConjuntoChaves& visitados = e.visitados;
+        nos.clear();
+        visitados.clear();
+        visitados.reservar(e.capacidade);
+        long long nos_expandidos = 0;
+        long long nos_visitados = 0;
+        long long soma_ramificacao = 0;
+        long long total_nos = 0;
+        bool encontrou = false;
+
+        nos.push_back(criarNo(inicial, -1, -1, 0, 0, 0));
+        visitados.inserir(Nucleo::chave(inicial));
+        TrechoRastreio camada("camada BFS", "busca", 0);
+        int camadaAtual = 0;
+
+        for (int atual = 0; atual < (int)nos.size(); ++atual) {
+            if (estourouMemoria(opcoes.limite_memoria)) {
+                stats.memoria_esgotada = true;
+                break;
+            }
+            nos_expandidos++;
+            if (nos[atual].profundidade != camadaAtual) {
+                camadaAtual = nos[atual].profundidade;
+                camada.proximo(camadaAtual);
+            }
+
+            if (Nucleo::verificarVitoria(nos[atual].tabuleiro)) {
+                stats.caminho = reconstruirCaminho(nos, atual);
+                stats.profundidade = nos[atual].profundidade;
+                stats.custo = (int)stats.caminho.size();
+                encontrou = true;
+                histograma.expandido(nos[atual].profundidade, 0, 0);
+                break;
+            }
+
+            Filhos filhos;
+            gerarFilhos(nos[atual].tabuleiro, visitados, filhos);
+            soma_ramificacao += filhos.q;
+            total_nos++;
+            int duplicados = 0;
+
+            for (int k = 0; k < filhos.q; ++k) {
+                if (visitados.inserir(filhos.chaves[k], filhos.hashes[k])) {
+                    nos_visitados++;
+                    int profundidade = nos[atual].profundidade + 1;
+                    nos.push_back(criarNo(filhos.tabuleiros[k], atual, filhos.movimentos[k], profundidade, 0, 0));
+                } else {
+                    duplicados++;
+                }
+            }
+            histograma.expandido(nos[atual].profundidade, filhos.q, duplicados);
+        }
+
+        finalizar(stats, encontrou, nos_expandidos, nos_visitados, soma_ramificacao, total_nos, start);
+        stats.pico_nos = (long long)nos.size();
+        histograma.exportar(stats, "profundidade");
+        return stats;
+    }
+
+    // Busca Ordenada (UCS) com fila de baldes de Dial: os custos sao inteiros
+    // e limitados por C = custoMaximo(), entao todo estado pendente tem g em
+    // [custoAtual, custoAtual + C] e C + 1 baldes circulares bastam. Entradas
+    // desatualizadas (g ja melhorado ou estado fechado) sao descartadas ao sair.
+    static SolverStats resolverUCS(const Tabuleiro& inicial, const OpcoesSolver& opcoes, Estruturas& e) {
+        const ModeloCusto& custos = opcoes.custos;
+        SolverStats stats;
+        auto start = Relogio::now();
+        Histograma histograma(opcoes.histograma);
+        VetorArena<No>& nos = e.nos;
+        MapaIndices& indices = e.indices;
+        nos.clear();
+        indices.clear();
+        indices.reservar(e.capacidade);
+        int numBaldes = custos.custoMaximo() + 1;
+        VetorArena<VetorArena<EntradaFila> > baldes(numBaldes);
+        size_t pendentes = 0;
+        long long nos_expandidos = 0;
+        long long nos_visitados = 0;
+        long long soma_ramificacao = 0;
+        long long total_nos = 0;
+        bool encontrou = false;
+
+        nos.push_back(criarNo(inicial, -1, -1, 0, 0, 0));
+        indices.inserir(Nucleo::chave(inicial), 0);
+        baldes[0].push_back(EntradaFila{ 0, 0 });
+        pendentes++;
+
+        for (int custoAtual = 0; pendentes > 0 && !encontrou; ++custoAtual) {
+            VetorArena<EntradaFila>& balde = baldes[custoAtual % numBaldes];
+            // Movimentos de custo 0 acrescentam ao proprio balde durante o laco
+            for (size_t b = 0; b < balde.size(); ++b) {
+                EntradaFila entrada = balde[b];
+                pendentes--;
+                int atual = entrada.indice;
+                if (nos[atual].fechado || nos[atual].custo_g != entrada.prioridade) continue;
+                if (estourouMemoria(opcoes.limite_memoria)) {
+                    stats.memoria_esgotada = true;
+                    pendentes = 0;
+                    break;
+                }
+                nos[atual].fechado = true;
+                nos_expandidos++;
+
+                if (Nucleo::verificarVitoria(nos[atual].tabuleiro)) {
+                    stats.caminho = reconstruirCaminho(nos, atual);
+                    stats.profundidade = nos[atual].profundidade;
+                    stats.custo = nos[atual].custo_g;
+                    encontrou = true;
+                    histograma.expandido(custoAtual, 0, 0);
+                    break;
+                }
+
+                Filhos filhos;
+                gerarFilhos(nos[atual].tabuleiro, indices, filhos);
+                soma_ramificacao += filhos.q;
+                total_nos++;
+                int vazio = Nucleo::encontrarEspacoVazio(nos[atual].tabuleiro);
+                int duplicados = 0;
+
+                for (int k = 0; k < filhos.q; ++k) {
+                    int g = custoAtual + custos.custo(filhos.movimentos[k], vazio);
+                    std::pair<int*, bool> r = indices.inserir(filhos.chaves[k], (int)nos.size(), filhos.hashes[k]);
+                    int filho = *r.first;
+                    if (r.second) {
+                        nos_visitados++;
+                        nos.push_back(criarNo(filhos.tabuleiros[k], atual, filhos.movimentos[k],
+                                              nos[atual].profundidade + 1, g, 0));
+                    } else if (!nos[filho].fechado && g < nos[filho].custo_g) {
+                        nos[filho].pai = atual;
+                        nos[filho].movimento = filhos.movimentos[k];
+                        nos[filho].profundidade = nos[atual].profundidade + 1;
+                        nos[filho].custo_g = g;
+                    } else {
+                        duplicados++;
+                        continue;
+                    }
+                    baldes[g % numBaldes].push_back(EntradaFila{ g, filho });
+                    pendentes++;
+                }
+                histograma.expandido(custoAtual, filhos.q, duplicados);
+            }
+            balde.clear();
+        }
+
+        finalizar(stats, encontrou, nos_expandidos, nos_visitados, soma_ramificacao, total_nos, start);
+        histograma.exportar(stats, "custo g");
+        return stats;
+    }
+
+    // --- Perimetro em volta dos objetivos (IDA* e A*) ---
+    //
+    // Os 2n + 1 objetivos sao conhecidos de antemao, entao uma busca em largura
+    // para tras a partir de todos eles da a distancia exata de cada estado a
+    // ate 'raio' movimentos do objetivo mais proximo, e o primeiro passo rumo
+    // a ele. Dentro do perimetro a heuristica passa a ser essa distancia; fora
+    // dele a distancia real passa de 'raio', entao h vale pelo menos raio + 1.
+    // Com h admissivel (consistente), o resultado tambem e.
+    //
+    // Os perimetros ficam guardados por (tamanho, raio) e sao compartilhados
+    // por todas as buscas seguintes, inclusive entre threads.
+
+    struct PassoPerimetro {
+        int distancia;
+        int movimento; // primeiro movimento rumo ao objetivo (-1 no objetivo)
+    };
+    typedef MapaPlano<Chave, PassoPerimetro, typename Nucleo::HashChave> MapaPerimetro;
+
+    struct Perimetro {
+        int raio;
+        MapaPerimetro passos;
+    };
+
+    // Conteineres da busca que um SolverWorkspace guarda entre uma busca e
+    // outra: cada algoritmo limpa os que usa (a capacidade fica). Fora do
+    // workspace, duram uma busca. O perimetro obtido fica guardado aqui para
+    // as buscas seguintes nao consultarem o cache global.
+    struct Estruturas {
+        explicit Estruturas(size_t capacidade) : capacidade(capacidade) {}
+
+        size_t capacidade;         // capacidade inicial dos visitados (capacidadeVisitados)
+        VetorArena<No> nos;        // BFS, DFS, UCS, Gulosa e A*
+        VetorArena<int> pilha;     // DFS
+        ConjuntoChaves visitados;  // BFS e DFS
+        MapaIndices indices;       // UCS, Gulosa e A*
+        HeapAbertos abertos;       // Gulosa e A*
+        std::shared_ptr<const Perimetro> perimetro;
+    };
+
+    static const Perimetro* perimetroDe(Estruturas& e, const Tabuleiro& inicial, int raio) {
+        if (!e.perimetro || e.perimetro->raio != raio) e.perimetro = obterPerimetro(inicial, raio);
+        return e.perimetro.get();
+    }
+
+    static std::shared_ptr<const Perimetro> obterPerimetro(const Tabuleiro& inicial, int raio) {
+        static std::mutex trava;
+        static std::map<std::pair<int, int>, std::shared_ptr<const Perimetro> > guardados;
+        int tamanho = (int)Nucleo::paraVetor(inicial).size();
+        std::lock_guard<std::mutex> bloqueio(trava);
+        std::shared_ptr<const Perimetro>& p = guardados[std::make_pair(tamanho, raio)];
+        if (!p) p = construirPerimetro(tamanho, raio);
+        return p;
+    }
+
+    static std::shared_ptr<const Perimetro> construirPerimetro(int tamanho, int raio) {
+        TrechoRastreio trecho("perimetro", "busca", raio);
+        std::shared_ptr<Perimetro> p = std::make_shared<Perimetro>();
+        p->raio = raio;
+        int n = (tamanho - 1) / 2;
+        std::vector<Tabuleiro> camada;
+        for (int v = 0; v < tamanho; ++v) {
+            std::vector<char> objetivo(n, 'B');
+            objetivo.insert(objetivo.end(), n, 'A');
+            objetivo.insert(objetivo.begin() + v, '_');
+            Tabuleiro t = Nucleo::deVetor(objetivo);
+            PassoPerimetro passo = { 0, -1 };
+            p->passos.inserir(Nucleo::chave(t), passo);
+            camada.push_back(t);
+        }
+        // Os movimentos sao reversiveis: voltar de um vizinho para 't' e mover
+        // para o vazio de 't' a ficha que ocupa essa casa no vizinho
+        for (int d = 1; d <= raio && !camada.empty(); ++d) {
+            std::vector<Tabuleiro> proxima;
+            for (const Tabuleiro& t : camada) {
+                int destinos[4];
+                int q = Nucleo::movimentos(t, destinos);
+                int vazio = Nucleo::encontrarEspacoVazio(t);
+                for (int k = 0; k < q; ++k) {
+                    Tabuleiro vizinho = Nucleo::aplicarMovimento(t, destinos[k]);
+                    PassoPerimetro passo = { d, vazio };
+                    if (p->passos.inserir(Nucleo::chave(vizinho), passo).second) proxima.push_back(vizinho);
+                }
+            }
+            camada.swap(proxima);
+        }
+        return p;
+    }
+
+    static const PassoPerimetro* noPerimetro(const Perimetro* p, const Tabuleiro& t) {
+        return p ? p->passos.procurar(Nucleo::chave(t)) : nullptr;
+    }
+
+    static int hComPerimetro(const Perimetro* p, const PassoPerimetro* passo, int h) {
+        if (passo) return passo->distancia;
+        return p ? std::max(h, p->raio + 1) : h;
+    }
+
+    // Acrescenta ao caminho os movimentos de 't' (no perimetro) ate o objetivo
+    static void completarPeloPerimetro(const Perimetro& p, Tabuleiro t, CaminhoCompacto& caminho) {
+        const PassoPerimetro* passo = p.passos.procurar(Nucleo::chave(t));
+        while (passo && passo->movimento >= 0) {
+            caminho.adicionar(passo->movimento);
+            t = Nucleo::aplicarMovimento(t, passo->movimento);
+            passo = p.passos.procurar(Nucleo::chave(t));
+        }
+    }
+
+    // Gulosa e A* diferem apenas na prioridade da fila. A lista aberta e um
+    // heap indexado: cada estado aparece nele no maximo uma vez. No A*, um
+    // estado alcancado por um caminho mais barato tem g e pai atualizados no
+    // lugar (decrease-key) e, se ja tiver sido expandido, e reaberto; assim o
+    // caminho continua otimo com qualquer heuristica admissivel, mesmo
+    // inconsistente. A de Manhattan nao e admissivel (conta 2 por pulo, que e
+    // um movimento so) e com ela o A* pode devolver caminhos mais longos. A
+    // heuristica conta movimentos, entao e multiplicada pelo menor custo de
+    // um movimento para continuar admissivel com custos diferentes de 1.
+    // Entre prioridades iguais vale OpcoesSolver::desempate; no A* isso so
+    // muda quantos estados da ultima camada de f (f = custo otimo) sao
+    // expandidos antes do objetivo.
+    // Com OpcoesSolver::raio_perimetro e custo unitario, o A* usa o perimetro
+    // e para ao expandir o primeiro estado dentro dele (h exata, f minimo).
+    static SolverStats resolverMelhorPrimeiro(const Tabuleiro& inicial, Ordem ordem, int heuristica,
+                                              const OpcoesSolver& opcoes, Estruturas& e) {
+        const ModeloCusto& custos = opcoes.custos;
+        SolverStats stats;
+        auto start = Relogio::now();
+        // A* por valor f; a Gulosa por profundidade
+        Histograma histograma(opcoes.histograma);
+        VetorArena<No>& nos = e.nos;
+        HeapAbertos& abertos = e.abertos;
+        MapaIndices& indices = e.indices;
+        nos.clear();
+        abertos.clear();
+        indices.clear();
+        indices.reservar(e.capacidade);
+        long long nos_expandidos = 0;
+        long long nos_visitados = 0;
+        long long soma_ramificacao = 0;
+        long long total_nos = 0;
+        long long reabertos = 0;
+        bool encontrou = false;
+        int escalaH = (ordem == ORDEM_A_ESTRELA) ? custos.custoMinimo() : 1;
+        const Perimetro* p = nullptr;
+        if (ordem == ORDEM_A_ESTRELA && opcoes.raio_perimetro > 0 && custos.unitario()) {
+            p = perimetroDe(e, inicial, opcoes.raio_perimetro);
+            stats.estados_perimetro = (long long)p->passos.size();
+        }
+
+        int h_inicial = hComPerimetro(p, noPerimetro(p, inicial), Nucleo::heuristica(inicial, heuristica) * escalaH);
+        nos.push_back(criarNo(inicial, -1, -1, 0, 0, h_inicial));
+        int sequencia = 0;
+        abertos.inserirOuAtualizar(0, prioridade(nos[0], ordem), chaveDesempate(nos[0], ordem, 0, sequencia++, opcoes));
+        indices.inserir(Nucleo::chave(inicial), 0);
+        long long expandidosCamada = 0;
+        // So o A* tem camadas de f no rastreio
+        int fAtual = prioridade(nos[0], ordem);
+        TrechoRastreio camadaF(ordem == ORDEM_A_ESTRELA ? "camada f A*" : "busca gulosa", "busca", fAtual);
+
+        while (!abertos.empty()) {
+            if (estourouMemoria(opcoes.limite_memoria)) {
+                stats.memoria_esgotada = true;
+                break;
+            }
+            HeapAbertos::Elemento topo = abertos.extrair();
+            int atual = topo.item;
+            nos[atual].fechado = true;
+            nos_expandidos++;
+
+            int camada = (ordem == ORDEM_A_ESTRELA) ? topo.prioridade : nos[atual].profundidade;
+            if (ordem == ORDEM_A_ESTRELA && topo.prioridade != fAtual) {
+                fAtual = topo.prioridade;
+                camadaF.proximo(fAtual);
+                expandidosCamada = 0;
+            }
+            expandidosCamada++;
+
+            if (Nucleo::verificarVitoria(nos[atual].tabuleiro) || (p && noPerimetro(p, nos[atual].tabuleiro))) {
+                stats.caminho = reconstruirCaminho(nos, atual);
+                if (p) completarPeloPerimetro(*p, nos[atual].tabuleiro, stats.caminho);
+                stats.profundidade = (int)stats.caminho.size();
+                stats.custo = (ordem == ORDEM_HEURISTICA) ? (int)stats.caminho.size()
+                                                          : nos[atual].custo_g + (p ? nos[atual].custo_h : 0);
+                if (ordem == ORDEM_A_ESTRELA) stats.expandidos_ultima_camada = expandidosCamada;
+                encontrou = true;
+                histograma.expandido(camada, 0, 0);
+                break;
+            }
+
+            Filhos filhos;
+            gerarFilhos(nos[atual].tabuleiro, indices, filhos);
+            soma_ramificacao += filhos.q;
+            total_nos++;
+            int vazio = Nucleo::encontrarEspacoVazio(nos[atual].tabuleiro);
+            int duplicados = 0;
+
+            for (int k = 0; k < filhos.q; ++k) {
+                int g = (ordem == ORDEM_HEURISTICA) ? 0 : nos[atual].custo_g + custos.custo(filhos.movimentos[k], vazio);
+                std::pair<int*, bool> r = indices.inserir(filhos.chaves[k], (int)nos.size(), filhos.hashes[k]);
+                int filho = *r.first;
+                if (r.second) {
+                    nos_visitados++;
+                    const Tabuleiro& novo = filhos.tabuleiros[k];
+                    int h = Nucleo::heuristica(novo, heuristica) * escalaH;
+                    if (p) h = hComPerimetro(p, p->passos.procurar(filhos.chaves[k], filhos.hashes[k]), h);
+                    nos.push_back(criarNo(novo, atual, filhos.movimentos[k], nos[atual].profundidade + 1, g, h));
+                } else if (ordem == ORDEM_A_ESTRELA && g < nos[filho].custo_g) {
+                    nos[filho].pai = atual;
+                    nos[filho].movimento = filhos.movimentos[k];
+                    nos[filho].profundidade = nos[atual].profundidade + 1;
+                    nos[filho].custo_g = g;
+                    if (nos[filho].fechado) {
+                        nos[filho].fechado = false;
+                        reabertos++;
+                    }
+                } else {
+                    duplicados++;
+                    continue;
+                }
+                abertos.inserirOuAtualizar(filho, prioridade(nos[filho], ordem),
+                                           chaveDesempate(nos[filho], ordem, filho, sequencia++, opcoes));
+            }
+            histograma.expandido(camada, filhos.q, duplicados);
+        }
+
+        finalizar(stats, encontrou, nos_expandidos, nos_visitados, soma_ramificacao, total_nos, start);
+        stats.nos_reabertos = reabertos;
+        stats.pico_nos = (long long)nos.size();
+        histograma.exportar(stats, ordem == ORDEM_A_ESTRELA ? "valor f" : "profundidade");
+        return stats;
+    }
+
+    static int prioridade(const No& no, Ordem ordem) {
+        return ordem == ORDEM_HEURISTICA ? no.custo_h : no.custo_g + no.custo_h;
+    }
+
+    // Chave secundaria da fila; 'sequencia' conta as insercoes
+    // (a Gulosa nao acumula g, entao "maior g" e a maior profundidade)
+    static int chaveDesempate(const No& no, Ordem ordem, int indice, int sequencia, const OpcoesSolver& opcoes) {
+        switch (opcoes.desempate) {
+            case DESEMPATE_MAIOR_G: return ordem == ORDEM_A_ESTRELA ? -no.custo_g : -no.profundidade;
+            case DESEMPATE_MENOR_H: return no.custo_h;
+            case DESEMPATE_LIFO: return -sequencia;
+            case DESEMPATE_ALEATORIO: {
+                // splitmix64 do indice com a semente: cada estado tem uma posicao fixa
+                uint64_t z = opcoes.semente_desempate + 0x9e3779b97f4a7c15ULL * (uint64_t)(indice + 1);
+                z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+                z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+                return (int)((z ^ (z >> 31)) >> 33);
+            }
+            case DESEMPATE_QUALQUER:
+            default: return 0;
+        }
+    }
+
+    // --- Busca de fronteira (Korf) para BFS e A* ---
+    //
+    // Guarda apenas os estados abertos; cada um leva uma mascara dos
+    // operadores (deslocamentos do vazio) que levam a vizinhos ja gerados, e
+    // esses nao sao gerados de novo. Estados expandidos sao descartados, entao
+    // a memoria fica no tamanho da fronteira, nao da regiao explorada.
+    //
+    // Sem os pais, o caminho e refeito por divisao e conquista: cada estado
+    // herda um estado "meio" do caminho que o alcancou (o primeiro em que g
+    // passa da metade da estimativa g + cota inferior). Achado o objetivo, a
+    // busca e repetida entre a origem e o meio e entre o meio e o objetivo,
+    // ate restarem trechos de um movimento. Como todo estado de um caminho
+    // otimo o divide em dois caminhos otimos, o resultado continua otimo desde
+    // que a heuristica seja consistente (a de inversoes e; a de Manhattan nem
+    // e admissivel). No modo BFS a heuristica e 0 e todo movimento custa 1;
+    // as buscas dos trechos usam a cota Nucleo::distanciaMinima ate o alvo.
+    // Com custos positivos cada trecho custa menos que o anterior, o que
+    // garante o fim da recursao; com movimentos de custo 0 isso nao vale e o
+    // A* usa a busca com lista de fechados (ver executar).
+
+    struct NoFronteira {
+        Tabuleiro tabuleiro;
+        Tabuleiro meio;
+        int g;
+        int h;
+        int profundidade;
+        unsigned char usados; // bit de cada operador ja usado (ver bitOperador)
+        bool temMeio;
+    };
+
+    struct ResultadoFronteira {
+        bool encontrou;
+        Tabuleiro destino;
+        Tabuleiro meio;
+        int custo;
+        int profundidade;
+    };
+
+    struct ContextoFronteira {
+        int heuristica;       // 0 = BFS
+        ModeloCusto custos;
+        int escalaH;
+        Relogio::time_point start;
+        double prazo;
+        size_t limite_memoria;
+        bool interrompida;
+        bool memoria_esgotada;
+        long long nos_expandidos;
+        long long nos_visitados;
+        long long soma_ramificacao;
+        long long pico_nos;
+    };
+
+    // Deslocamento do vazio (-1, +1, -2, +2) -> bit da mascara de operadores
+    static int bitOperador(int deslocamento) {
+        return deslocamento == -1 ? 1 : deslocamento == 1 ? 2 : deslocamento == -2 ? 4 : 8;
+    }
+
+    // Com 'alvo' nulo o destino e qualquer objetivo; senao, o proprio alvo
+    static int cotaFronteira(const Tabuleiro& t, const Tabuleiro* alvo) {
+        return alvo ? Nucleo::distanciaMinima(t, *alvo) : Nucleo::limiteInferior(t);
+    }
+
+    // Os trechos (alvo conhecido) usam a cota inferior ate o alvo mesmo no modo BFS
+    static int hFronteira(const ContextoFronteira& ctx, const Tabuleiro& t, const Tabuleiro* alvo) {
+        if (alvo) return Nucleo::distanciaMinima(t, *alvo) * ctx.escalaH;
+        if (ctx.heuristica == 0) return 0;
+        return Nucleo::heuristica(t, ctx.heuristica) * ctx.escalaH;
+    }
+
+    static bool chegou(const Tabuleiro& t, const Tabuleiro* alvo) {
+        return alvo ? Nucleo::chave(t) == Nucleo::chave(*alvo) : Nucleo::verificarVitoria(t);
+    }
+
+    static ResultadoFronteira buscaFronteira(ContextoFronteira& ctx, const Tabuleiro& origem, const Tabuleiro* alvo) {
+        ResultadoFronteira resultado;
+        resultado.encontrou = false;
+        VetorArena<NoFronteira> nos;
+        VetorArena<int> livres;
+        HeapAbertos abertos;
+        MapaIndices indices;
+
+        NoFronteira raiz;
+        raiz.tabuleiro = origem;
+        raiz.g = 0;
+        raiz.h = hFronteira(ctx, origem, alvo);
+        raiz.profundidade = 0;
+        raiz.usados = 0;
+        raiz.temMeio = false;
+        nos.push_back(raiz);
+        indices.inserir(Nucleo::chave(origem), 0);
+        abertos.inserirOuAtualizar(0, raiz.h, 0);
+        int escalaCota = ctx.heuristica == 0 ? 1 : ctx.escalaH;
+
+        while (!abertos.empty()) {
+            if (estourouTimeout(ctx.start, ctx.prazo)) {
+                ctx.interrompida = true;
+                break;
+            }
+            if (estourouMemoria(ctx.limite_memoria)) {
+                ctx.interrompida = ctx.memoria_esgotada = true;
+                break;
+            }
+            int atual = abertos.extrair().item;
+            const NoFronteira no = nos[atual];
+            indices.remover(Nucleo::chave(no.tabuleiro));
+            livres.push_back(atual);
+            ctx.nos_expandidos++;
+
+            if (chegou(no.tabuleiro, alvo)) {
+                resultado.encontrou = true;
+                resultado.destino = no.tabuleiro;
+                resultado.meio = no.meio;
+                resultado.custo = no.g;
+                resultado.profundidade = no.profundidade;
+                break;
+            }
+
+            int vazio = Nucleo::encontrarEspacoVazio(no.tabuleiro);
+            int movimentos[4];
+            int q = Nucleo::movimentos(no.tabuleiro, movimentos);
+            ctx.soma_ramificacao += q;
+            for (int k = 0; k < q; ++k) {
+                if (no.usados & bitOperador(movimentos[k] - vazio)) continue;
+                Tabuleiro novo = Nucleo::aplicarMovimento(no.tabuleiro, movimentos[k]);
+                int g = no.g + (ctx.heuristica == 0 ? 1 : ctx.custos.custo(movimentos[k], vazio));
+                int volta = bitOperador(vazio - movimentos[k]);
+
+                std::pair<int*, bool> r = indices.inserir(Nucleo::chave(novo), -1);
+                int filho = *r.first;
+                if (r.second) {
+                    if (livres.empty()) {
+                        filho = (int)nos.size();
+                        nos.push_back(NoFronteira());
+                    } else {
+                        filho = livres.back();
+                        livres.pop_back();
+                    }
+                    *r.first = filho;
+                    nos[filho].tabuleiro = novo;
+                    nos[filho].h = hFronteira(ctx, novo, alvo);
+                    nos[filho].usados = volta;
+                    ctx.nos_visitados++;
+                } else {
+                    nos[filho].usados |= volta;
+                    if (g >= nos[filho].g) continue;
+                }
+
+                NoFronteira& f = nos[filho];
+                f.g = g;
+                f.profundidade = no.profundidade + 1;
+                if (no.temMeio) {
+                    f.meio = no.meio;
+                    f.temMeio = true;
+                } else if (g >= cotaFronteira(novo, alvo) * escalaCota) {
+                    // Primeiro estado alem da metade: o meio e o pai (ou o
+                    // filho, se o pai for a origem), sempre interior ao caminho
+                    f.meio = no.profundidade == 0 ? novo : no.tabuleiro;
+                    f.temMeio = true;
+                } else {
+                    f.temMeio = false;
+                }
+                abertos.inserirOuAtualizar(filho, f.g + f.h, -f.g);
+            }
+            ctx.pico_nos = std::max(ctx.pico_nos, (long long)indices.size());
+        }
+        return resultado;
+    }
+
+    static bool caminhoFronteira(ContextoFronteira& ctx, const Tabuleiro& origem, const Tabuleiro* alvo,
+                                 CaminhoCompacto& caminho, int* custo) {
+        ResultadoFronteira r = buscaFronteira(ctx, origem, alvo);
+        if (!r.encontrou) return false;
+        if (custo) *custo = r.custo;
+        if (r.profundidade == 0) return true;
+        if (r.profundidade == 1) {
+            caminho.adicionar(Nucleo::encontrarEspacoVazio(r.destino));
+            return true;
+        }
+        Tabuleiro meio = r.meio;
+        Tabuleiro destino = r.destino;
+        return caminhoFronteira(ctx, origem, &meio, caminho, nullptr) &&
+               caminhoFronteira(ctx, meio, &destino, caminho, nullptr);
+    }
+
+    static SolverStats resolverFronteira(const Tabuleiro& inicial, int heuristica, const OpcoesSolver& opcoes) {
+        SolverStats stats;
+        ContextoFronteira ctx;
+        ctx.heuristica = heuristica;
+        ctx.custos = heuristica == 0 ? ModeloCusto() : opcoes.custos;
+        ctx.escalaH = ctx.custos.custoMinimo();
+        ctx.start = Relogio::now();
+        ctx.prazo = opcoes.prazo;
+        ctx.limite_memoria = opcoes.limite_memoria;
+        ctx.interrompida = false;
+        ctx.memoria_esgotada = false;
+        ctx.nos_expandidos = 0;
+        ctx.nos_visitados = 0;
+        ctx.soma_ramificacao = 0;
+        ctx.pico_nos = 0;
+        TrechoRastreio trecho("busca de fronteira", "busca", heuristica);
+
+        stats.caminho = CaminhoCompacto(Nucleo::encontrarEspacoVazio(inicial));
+        bool encontrou = caminhoFronteira(ctx, inicial, nullptr, stats.caminho, nullptr) && !ctx.interrompida;
+        if (encontrou) {
+            // O g do objetivo na busca de cima so vale para o caminho refeito
+            // com heuristica consistente: o custo sai do caminho devolvido
+            stats.profundidade = (int)stats.caminho.size();
+            for (const CaminhoCompacto::Passo& passo : stats.caminho) {
+                stats.custo += ctx.custos.custo(passo.posicao, passo.vazio);
+            }
+        }
+        finalizar(stats, encontrou, ctx.nos_expandidos, ctx.nos_visitados, ctx.soma_ramificacao,
+                  ctx.nos_expandidos, ctx.start);
+        stats.pico_nos = ctx.pico_nos;
+        stats.memoria_esgotada = ctx.memoria_esgotada;
+        return stats;
+    }
+
+    // Tamanho da solucao construtiva (limite superior do otimo), ou -1 se nao houver.
+    // Se 'caminho' nao for nulo, recebe tambem os movimentos.
+    static long long custoConstrutivo(const Tabuleiro& inicial, CaminhoCompacto* caminho) {
+        if (caminho) *caminho = CaminhoCompacto(Nucleo::encontrarEspacoVazio(inicial));
+        return Solver::construirSolucao(Nucleo::paraVetor(inicial), [caminho](int posicao) {
+            if (caminho) caminho->adicionar(posicao);
+        });
+    }
+
+    // Backtracking
+    struct ContextoBacktracking {
+        Relogio::time_point start;
+        double timeout;
+        int limite_profundidade;
+        CaminhoCompacto caminho;
+        ConjuntoChaves visitados;
+        long long nos_expandidos;
+        long long nos_visitados;
+        long long soma_ramificacao;
+        long long total_nos;
+        long long podados;
+        bool poda_automato;
+        bool poda_caminho;
+        Histograma histograma;
+        SolverStats* stats;
+    };
+
+    static bool backtrack(ContextoBacktracking& ctx, const Tabuleiro& tabuleiro, int profundidade, int estado) {
+        if (estourouTimeout(ctx.start, ctx.timeout)) return false;
+        if (profundidade > ctx.limite_profundidade) return false;
+        ctx.nos_expandidos++;
+        if (Nucleo::verificarVitoria(tabuleiro)) {
+            ctx.stats->caminho = ctx.caminho;
+            ctx.stats->profundidade = profundidade;
+            ctx.stats->custo = (int)ctx.caminho.size();
+            ctx.histograma.expandido(profundidade, 0, 0);
+            return true;
+        }
+        Chave chaveAtual;
+        if (ctx.poda_caminho) {
+            chaveAtual = Nucleo::chave(tabuleiro);
+            ctx.visitados.inserir(chaveAtual);
+        }
+        Filhos filhos;
+        int proximos[4] = { 0, 0, 0, 0 };
+        if (ctx.poda_automato) {
+            ctx.podados += gerarFilhosPodados(tabuleiro, estado, ctx.poda_caminho ? &ctx.visitados : nullptr,
+                                              filhos, proximos);
+        } else {
+            gerarFilhos(tabuleiro, ctx.visitados, filhos);
+        }
+        ctx.soma_ramificacao += filhos.q;
+        ctx.total_nos++;
+        ctx.histograma.expandido(profundidade, filhos.q, 0);
+        for (int k = 0; k < filhos.q; ++k) {
+            if (!ctx.poda_caminho || !ctx.visitados.contem(filhos.chaves[k], filhos.hashes[k])) {
+                ctx.nos_visitados++;
+                ctx.caminho.adicionar(filhos.movimentos[k]);
+                if (backtrack(ctx, filhos.tabuleiros[k], profundidade + 1, proximos[k])) {
+                    return true;
+                }
+                ctx.caminho.remover();
+            } else {
+                ctx.histograma.somar(profundidade, 0, 0, 1);
+            }
+        }
+        if (ctx.poda_caminho) ctx.visitados.remover(chaveAtual);
+        return false;
+    }
+
+    static SolverStats resolverBacktracking(const Tabuleiro& inicial, double timeout, const OpcoesSolver& opcoes) {
+        SolverStats stats;
+        ContextoBacktracking ctx;
+        ctx.start = Relogio::now();
+        ctx.timeout = timeout;
+        // Nenhum caminho mais longo que a solucao construtiva precisa ser explorado
+        const int LIMITE_PROFUNDIDADE = 10000;
+        long long construtivo = custoConstrutivo(inicial, nullptr);
+        ctx.limite_profundidade = construtivo >= 0 ? (int)std::min<long long>(construtivo, LIMITE_PROFUNDIDADE)
+                                                   : LIMITE_PROFUNDIDADE;
+        ctx.nos_expandidos = 0;
+        ctx.nos_visitados = 0;
+        ctx.soma_ramificacao = 0;
+        ctx.total_nos = 0;
+        ctx.podados = 0;
+        ctx.poda_automato = opcoes.poda_automato;
+        ctx.poda_caminho = opcoes.poda_caminho || !opcoes.poda_automato;
+        ctx.histograma = Histograma(opcoes.histograma);
+        ctx.stats = &stats;
+        ctx.caminho = CaminhoCompacto(Nucleo::encontrarEspacoVazio(inicial));
+        bool encontrou = backtrack(ctx, inicial, 0, AutomatoPoda::INICIAL);
+        finalizar(stats, encontrou, ctx.nos_expandidos, ctx.nos_visitados,
+                  ctx.soma_ramificacao, ctx.total_nos, ctx.start);
+        stats.movimentos_podados = ctx.podados;
+        ctx.histograma.exportar(stats, "profundidade");
+        return stats;
+    }
+
+    // DFS (Busca em Profundidade)
+    static SolverStats resolverDFS(const Tabuleiro& inicial, double timeout, const OpcoesSolver& opcoes,
+                                   Estruturas& e) {
+        SolverStats stats;
+        auto start = Relogio::now();
+        Histograma histograma(opcoes.histograma);
+        VetorArena<No>& nos = e.nos;
+        VetorArena<int>& pilha = e.pilha;
+        ConjuntoChaves& visitados = e.visitados;
+        nos.clear();
+        pilha.clear();
+        visitados.clear();
+        visitados.reservar(e.capacidade);
+        long long nos_expandidos = 0;  // Nós que geraram filhos
+        long long nos_visitados = 0;   // Nós que foram desempilhados e processados
+        long long soma_ramificacao = 0;
+        long long total_nos = 0;
+        bool encontrou = false;
+
+        nos.push_back(criarNo(inicial, -1, -1, 0, 0, 0));
+        pilha.push_back(0);
+
+        while (!pilha.empty()) {
+            if (estourouTimeout(start, timeout)) break;
+            if (estourouMemoria(opcoes.limite_memoria)) {
+                stats.memoria_esgotada = true;
+                break;
+            }
+
+            int atual = pilha.back();
+            pilha.pop_back();
+
+            // Marcar como visitado ao processar o nó
+            if (!visitados.inserir(Nucleo::chave(nos[atual].tabuleiro))) continue;
+            nos_visitados++;
+
+            if (Nucleo::verificarVitoria(nos[atual].tabuleiro)) {
+                stats.caminho = reconstruirCaminho(nos, atual);
+                stats.profundidade = nos[atual].profundidade;
+                stats.custo = (int)stats.caminho.size();
+                encontrou = true;
+                break;
+            }
+
+            Filhos filhos;
+            gerarFilhos(nos[atual].tabuleiro, visitados, filhos);
+            soma_ramificacao += filhos.q;
+            total_nos++;
+            nos_expandidos++;
+
+            // Empilha na ordem inversa para explorar o primeiro movimento primeiro
+            int duplicados = 0;
+            for (int k = filhos.q - 1; k >= 0; --k) {
+                if (!visitados.contem(filhos.chaves[k], filhos.hashes[k])) {
+                    nos.push_back(criarNo(filhos.tabuleiros[k], atual, filhos.movimentos[k], nos[atual].profundidade + 1, 0, 0));
+                    pilha.push_back((int)nos.size() - 1);
+                } else {
+                    duplicados++;
+                }
+            }
+            histograma.expandido(nos[atual].profundidade, filhos.q, duplicados);
+        }
+
+        finalizar(stats, encontrou, nos_expandidos, nos_visitados, soma_ramificacao, total_nos, start);
+        histograma.exportar(stats, "profundidade");
+        return stats;
+    }
+
+    // IDA*
+    struct ContextoIDA {
+        Relogio::time_point start;
+        int heuristica;
+        int limite;
+        CaminhoCompacto caminho;
+        ConjuntoChaves visitados; // estados do caminho atual
+        long long nos_expandidos;
+        long long nos_visitados;
+        long long soma_ramificacao;
+        long long total_nos;
+        long long duplicados;     // filhos ja presentes no caminho atual
+        long long podados;        // movimentos descartados pelo automato
+        bool poda_automato;
+        bool poda_caminho;        // sempre ligada sem o automato
+        const Perimetro* perimetro;
+        bool timeout_ocorreu;
+        SolverStats* stats;
+    };
+
+    // 'estado' e o estado do automato de poda depois dos movimentos do caminho
+    static bool idaStar(ContextoIDA& ctx, const Tabuleiro& tabuleiro, int profundidade, int custo_g, int estado) {
+        if (estourouTimeout(ctx.start, TIMEOUT_PADRAO)) {
+            ctx.timeout_ocorreu = true;
+            return false;
+        }
+
+        ctx.nos_expandidos++;
+
+        if (Nucleo::verificarVitoria(tabuleiro)) {
+            ctx.stats->caminho = ctx.caminho;
+            ctx.stats->profundidade = profundidade;
+            ctx.stats->custo = custo_g;
+            return true;
+        }
+
+        const PassoPerimetro* passo = noPerimetro(ctx.perimetro, tabuleiro);
+        int f = custo_g + hComPerimetro(ctx.perimetro, passo, Nucleo::heuristica(tabuleiro, ctx.heuristica));
+        if (f > ctx.limite) return false;
+        if (passo) {
+            // Dentro do perimetro f e exato: o restante do caminho ja e conhecido
+            ctx.stats->caminho = ctx.caminho;
+            completarPeloPerimetro(*ctx.perimetro, tabuleiro, ctx.stats->caminho);
+            ctx.stats->profundidade = (int)ctx.stats->caminho.size();
+            ctx.stats->custo = f;
+            return true;
+        }
+
+        Chave chaveAtual;
+        if (ctx.poda_caminho) {
+            chaveAtual = Nucleo::chave(tabuleiro);
+            ctx.visitados.inserir(chaveAtual);
+        }
+        Filhos filhos;
+        int proximos[4] = { 0, 0, 0, 0 };
+        if (ctx.poda_automato) {
+            ctx.podados += gerarFilhosPodados(tabuleiro, estado, ctx.poda_caminho ? &ctx.visitados : nullptr,
+                                              filhos, proximos);
+        } else {
+            gerarFilhos(tabuleiro, ctx.visitados, filhos);
+        }
+        ctx.soma_ramificacao += filhos.q;
+        ctx.total_nos++;
+
+        for (int k = 0; k < filhos.q; ++k) {
+            if (!ctx.poda_caminho || !ctx.visitados.contem(filhos.chaves[k], filhos.hashes[k])) {
+                ctx.nos_visitados++;
+                ctx.caminho.adicionar(filhos.movimentos[k]);
+                if (idaStar(ctx, filhos.tabuleiros[k], profundidade + 1, custo_g + 1, proximos[k])) {
+                    return true;
+                }
+                ctx.caminho.remover();
+                if (ctx.timeout_ocorreu) return false; // Interrompe busca se timeout ocorrer em chamadas recursivas
+            } else {
+                ctx.duplicados++;
+            }
+        }
+
+        if (ctx.poda_caminho) ctx.visitados.remover(chaveAtual);
+        return false;
+    }
+
+    // O histograma tem uma camada por iteracao (limite de f); a ramificacao
+    // efetiva entre camadas e o crescimento de uma iteracao para a seguinte.
+    static SolverStats resolverIDAStar(const Tabuleiro& inicial, int heuristica, const OpcoesSolver& opcoes,
+                                       Estruturas& e) {
+        SolverStats stats;
+        ContextoIDA ctx;
+        ctx.start = Relogio::now();
+        ctx.heuristica = heuristica;
+        ctx.perimetro = nullptr;
+        if (opcoes.raio_perimetro > 0) {
+            ctx.perimetro = perimetroDe(e, inicial, opcoes.raio_perimetro);
+            stats.estados_perimetro = (long long)ctx.perimetro->passos.size();
+        }
+        ctx.limite = hComPerimetro(ctx.perimetro, noPerimetro(ctx.perimetro, inicial),
+                                   Nucleo::heuristica(inicial, heuristica));
+        ctx.nos_expandidos = 0;
+        ctx.nos_visitados = 0;
+        ctx.soma_ramificacao = 0;
+        ctx.total_nos = 0;
+        ctx.duplicados = 0;
+        ctx.podados = 0;
+        ctx.poda_automato = opcoes.poda_automato;
+        ctx.poda_caminho = opcoes.poda_caminho || !opcoes.poda_automato;
+        ctx.timeout_ocorreu = false;
+        ctx.stats = &stats;
+        Histograma histograma(opcoes.histograma);
+        bool encontrou = false;
+
+        while (!ctx.timeout_ocorreu) {
+            TrechoRastreio iteracao("iteracao IDA*", "busca", ctx.limite);
+            ctx.visitados.clear();
+            ctx.caminho = CaminhoCompacto(Nucleo::encontrarEspacoVazio(inicial));
+            long long expandidosAntes = ctx.nos_expandidos;
+            long long geradosAntes = ctx.soma_ramificacao;
+            long long duplicadosAntes = ctx.duplicados;
+            encontrou = idaStar(ctx, inicial, 0, 0, AutomatoPoda::INICIAL);
+            histograma.somar(ctx.limite, ctx.nos_expandidos - expandidosAntes,
+                             ctx.soma_ramificacao - geradosAntes, ctx.duplicados - duplicadosAntes);
+            if (encontrou) break;
+            ctx.limite++;
+        }
+
+        finalizar(stats, encontrou, ctx.nos_expandidos, ctx.nos_visitados,
+                  ctx.soma_ramificacao, ctx.total_nos, ctx.start);
+        stats.movimentos_podados = ctx.podados;
+        histograma.exportar(stats, "iteracao (limite de f)");
+        return stats;
+    }
+
+    // --- A* anytime (ARA*) ---
+    //
+    // Comeca com um peso alto na heuristica (f = g + peso * h) para achar uma
+    // solucao rapido e vai reduzindo o peso. Os valores de g e os pais sao
+    // mantidos entre as iteracoes: so os estados cujo g melhorou depois de
+    // expandidos (lista INCONS) voltam para a fila aberta.
+
+    struct NoARA {
+        Tabuleiro tabuleiro;
+        int pai;
+        int movimento;
+        int profundidade;
+        int custo_g;
+        int custo_h;
+        int limite_inferior;
+        bool aberto;
+        bool fechado;
+        bool inconsistente;
+    };
+
+    struct EntradaARA {
+        double f;
+        int indice;
+        int custo_g; // g no momento da insercao (entradas desatualizadas sao descartadas)
+    };
+
+    struct CompararARA {
+        bool operator()(const EntradaARA& a, const EntradaARA& b) const {
+            return a.f > b.f;
+        }
+    };
+
+    static CaminhoCompacto reconstruirCaminhoARA(const VetorArena<NoARA>& nos, int indice) {
+        std::vector<int> caminho;
+        while (indice >= 0 && nos[indice].pai >= 0) {
+            caminho.push_back(nos[indice].movimento);
+            indice = nos[indice].pai;
+        }
+        std::reverse(caminho.begin(), caminho.end());
+        // 'indice' e a raiz: o caminho guardado comeca pelo vazio dela
+        return CaminhoCompacto::deCaminho(Nucleo::encontrarEspacoVazio(nos[indice].tabuleiro), caminho);
+    }
+
+    static int hARA(const NoARA& no, bool usarLimiteInferior) {
+        return usarLimiteInferior ? no.limite_inferior : no.custo_h;
+    }
+
+    static SolverStats resolverARAStar(const Tabuleiro& inicial, int heuristica, const OpcoesSolver& opcoes) {
+        const int INFINITO = 0x3fffffff;
+        SolverStats melhor;
+        auto start = Relogio::now();
+        Histograma histograma(opcoes.histograma);
+        VetorArena<NoARA> nos;
+        MapaIndices indices;
+        VetorArena<int> inconsistentes;
+        std::priority_queue<EntradaARA, VetorArena<EntradaARA>, CompararARA> fila;
+        long long nos_expandidos = 0;
+        long long nos_visitados = 0;
+        long long soma_ramificacao = 0;
+        long long total_nos = 0;
+        int objetivo = -1;
+        int custoPublicado = INFINITO;
+        double limitePublicado = 0.0;
+        double peso = std::max(1.0, opcoes.peso_inicial);
+        // A solucao construtiva e a primeira incumbente: e publicada antes da
+        // busca e poda todo estado com g + limiteInferior que nao a melhore.
+        CaminhoCompacto caminhoSemente;
+        long long construtivo = custoConstrutivo(inicial, &caminhoSemente);
+        int custoSemente = construtivo >= 0 ? (int)construtivo : INFINITO;
+        auto incumbente = [&]() {
+            return objetivo >= 0 ? std::min(nos[objetivo].custo_g, custoSemente) : custoSemente;
+        };
+        auto publicar = [&](int custo, double limite) {
+            if (objetivo >= 0 && nos[objetivo].custo_g == custo) {
+                melhor.caminho = reconstruirCaminhoARA(nos, objetivo);
+                melhor.profundidade = nos[objetivo].profundidade;
+            } else {
+                melhor.caminho = caminhoSemente;
+                melhor.profundidade = (int)caminhoSemente.size();
+            }
+            melhor.custo = custo;
+            melhor.limite_subotimalidade = limite;
+            finalizar(melhor, true, nos_expandidos, nos_visitados, soma_ramificacao, total_nos, start);
+            custoPublicado = custo;
+            limitePublicado = limite;
+            if (opcoes.aoMelhorarSolucao) opcoes.aoMelhorarSolucao(melhor);
+        };
+        double decremento = opcoes.decremento_peso > 0.0 ? opcoes.decremento_peso : 0.5;
+        bool usarLimiteInferior = false;
+
+        NoARA raiz = { inicial, -1, -1, 0, 0, Nucleo::heuristica(inicial, heuristica),
+                       Nucleo::limiteInferior(inicial), true, false, false };
+        nos.push_back(raiz);
+        indices.reservar(capacidadeVisitados(inicial));
+        indices.inserir(Nucleo::chave(inicial), 0);
+        if (Nucleo::verificarVitoria(inicial)) objetivo = 0;
+        fila.push(EntradaARA{ peso * raiz.custo_h, 0, 0 });
+        if (objetivo < 0 && custoSemente < INFINITO) {
+            publicar(custoSemente, (double)custoSemente / std::max(1, raiz.limite_inferior));
+        }
+
+        bool prazoEsgotado = false;
+        bool memoriaEsgotada = false;
+        TrechoRastreio iteracao("iteracao ARA*", "busca", 0);
+        for (int numIteracao = 1; ; ++numIteracao) {
+            // ImprovePath: expande enquanto algum aberto puder melhorar a solucao atual
+            while (!fila.empty()) {
+                if (estourouTimeout(start, opcoes.prazo)) {
+                    prazoEsgotado = true;
+                    break;
+                }
+                if (estourouMemoria(opcoes.limite_memoria)) {
+                    prazoEsgotado = memoriaEsgotada = true;
+                    break;
+                }
+                EntradaARA topo = fila.top();
+                if (!nos[topo.indice].aberto || topo.custo_g != nos[topo.indice].custo_g) {
+                    fila.pop();
+                    continue;
+                }
+                if (incumbente() <= topo.f) break;
+                fila.pop();
+
+                int atual = topo.indice;
+                nos[atual].aberto = false;
+                nos[atual].fechado = true;
+                nos_expandidos++;
+                if (Nucleo::verificarVitoria(nos[atual].tabuleiro)) {
+                    histograma.expandido(nos[atual].profundidade, 0, 0);
+                    continue;
+                }
+
+                Filhos filhos;
+                gerarFilhos(nos[atual].tabuleiro, indices, filhos);
+                soma_ramificacao += filhos.q;
+                total_nos++;
+                histograma.expandido(nos[atual].profundidade, filhos.q, 0);
+
+                for (int k = 0; k < filhos.q; ++k) {
+                    std::pair<int*, bool> r = indices.inserir(filhos.chaves[k], (int)nos.size(), filhos.hashes[k]);
+                    int filho = *r.first;
+                    if (r.second) {
+                        const Tabuleiro& novo = filhos.tabuleiros[k];
+                        NoARA no = { novo, -1, -1, 0, INFINITO, Nucleo::heuristica(novo, heuristica),
+                                     Nucleo::limiteInferior(novo), false, false, false };
+                        nos.push_back(no);
+                        nos_visitados++;
+                    } else {
+                        histograma.somar(nos[atual].profundidade, 0, 0, 1);
+                    }
+
+                    int g = nos[atual].custo_g + 1;
+                    if (g >= nos[filho].custo_g) continue;
+                    if (g + nos[filho].limite_inferior >= incumbente()) continue;
+                    nos[filho].custo_g = g;
+                    nos[filho].pai = atual;
+                    nos[filho].movimento = filhos.movimentos[k];
+                    nos[filho].profundidade = nos[atual].profundidade + 1;
+                    if (Nucleo::verificarVitoria(nos[filho].tabuleiro) &&
+                        (objetivo < 0 || g < nos[objetivo].custo_g)) {
+                        objetivo = filho;
+                    }
+                    if (!nos[filho].fechado) {
+                        nos[filho].aberto = true;
+                        fila.push(EntradaARA{ g + peso * hARA(nos[filho], usarLimiteInferior), filho, g });
+                    } else if (!nos[filho].inconsistente) {
+                        nos[filho].inconsistente = true;
+                        inconsistentes.push_back(filho);
+                    }
+                }
+            }
+
+            if (incumbente() >= INFINITO) break;
+
+            // Limite de subotimalidade: todo caminho otimo passa por algum estado
+            // aberto ou inconsistente com g correto, logo o otimo e pelo menos
+            // o menor g + limiteInferior entre eles.
+            int custo = incumbente();
+            int limiteOtimo = custo;
+            for (size_t i = 0; i < nos.size(); ++i) {
+                if (nos[i].aberto || nos[i].inconsistente) {
+                    limiteOtimo = std::min(limiteOtimo, nos[i].custo_g + nos[i].limite_inferior);
+                }
+            }
+            double limite = limiteOtimo > 0 ? (double)custo / limiteOtimo : 1.0;
+            if (custo < custoPublicado || limite < limitePublicado) publicar(custo, limite);
+
+            if (prazoEsgotado || limite <= 1.0 || (peso <= 1.0 && usarLimiteInferior)) break;
+            if (fila.empty() && inconsistentes.empty()) break;
+
+            // Proxima iteracao: peso menor, INCONS volta para a fila aberta e CLOSED e esvaziada.
+            // Com peso 1 e ainda sem prova de otimalidade (heuristica nao admissivel),
+            // a ultima iteracao passa a ordenar pelo limite inferior admissivel.
+            if (peso <= 1.0) usarLimiteInferior = true;
+            peso = std::max(1.0, peso - decremento);
+            iteracao.proximo(numIteracao);
+            for (size_t k = 0; k < inconsistentes.size(); ++k) {
+                nos[inconsistentes[k]].inconsistente = false;
+                nos[inconsistentes[k]].aberto = true;
+            }
+            inconsistentes.clear();
+            VetorArena<EntradaARA> entradas;
+            for (size_t i = 0; i < nos.size(); ++i) {
+                nos[i].fechado = false;
+                if (nos[i].aberto) {
+                    entradas.push_back(EntradaARA{ nos[i].custo_g + peso * hARA(nos[i], usarLimiteInferior), (int)i, nos[i].custo_g });
+                }
+            }
+            fila = std::priority_queue<EntradaARA, VetorArena<EntradaARA>, CompararARA>(CompararARA(), entradas);
+        }
+
+        if (incumbente() >= INFINITO) {
+            finalizar(melhor, false, nos_expandidos, nos_visitados, soma_ramificacao, total_nos, start);
+        } else {
+            // Contadores e tempo totais, mesmo que a ultima iteracao nao tenha melhorado a solucao
+            finalizar(melhor, true, nos_expandidos, nos_visitados, soma_ramificacao, total_nos, start);
+        }
+        melhor.memoria_esgotada = memoriaEsgotada;
+        histograma.exportar(melhor, "profundidade");
+        return melhor;
+    }
+
+    // --- Busca em feixe ---
+    //
+    // Mantem apenas os 'largura' melhores estados de cada camada (pela
+    // heuristica escolhida), o que limita o trabalho por camada e guarda so
+    // O(largura) tabuleiros. Os filhos sao avaliados num tabuleiro de rascunho
+    // (aplica, avalia, desfaz) e so os selecionados sao copiados para a
+    // proxima camada. Para que o feixe nao fique andando em ciclos nos platos
+    // da heuristica, os feixes das ultimas 'janela_feixe' camadas ficam
+    // guardados, indexados pelo hash de 64 bits; um filho so e descartado se o
+    // hash bater e o tabuleiro for o mesmo. Das camadas mais antigas ficam
+    // apenas as ligacoes (pai, movimento) para refazer o caminho.
+
+    struct CandidatoFeixe {
+        int h;
+        int pai;       // indice no feixe atual
+        int movimento;
+        uint64_t hash;
+    };
+
+    struct CompararCandidato {
+        bool operator()(const CandidatoFeixe& a, const CandidatoFeixe& b) const {
+            return a.h != b.h ? a.h < b.h : a.hash < b.hash;
+        }
+    };
+
+    struct LigacaoFeixe {
+        int pai;
+        int movimento;
+    };
+
+    // Estado guardado na janela: camada e posicao no feixe dela
+    struct RefFeixe {
+        int camada;
+        int indice;
+    };
+
+    // Trabalho de uma thread: expande o intervalo [inicio, fim) do feixe
+    struct TrabalhoFeixe {
+        size_t inicio;
+        size_t fim;
+        std::vector<CandidatoFeixe> candidatos;
+        int pai_objetivo;
+        int movimento_objetivo;
+        int ramificacao;
+    };
+
+    static void expandirFeixe(const std::vector<Tabuleiro>& feixe, const std::vector<int>& vazioAnterior,
+                              int heuristica, TrabalhoFeixe& trabalho) {
+        TrechoRastreio tarefa("expansao do feixe", "tarefa", (long long)(trabalho.fim - trabalho.inicio));
+        trabalho.candidatos.clear();
+        trabalho.pai_objetivo = -1;
+        trabalho.ramificacao = 0;
+        for (size_t i = trabalho.inicio; i < trabalho.fim && trabalho.pai_objetivo < 0; ++i) {
+            Tabuleiro rascunho = feixe[i];
+            int vazio = Nucleo::encontrarEspacoVazio(rascunho);
+            int movimentos[4];
+            int q = Nucleo::movimentos(rascunho, movimentos);
+            trabalho.ramificacao += q;
+            for (int k = 0; k < q; ++k) {
+                // Desfazer o ultimo movimento so devolveria o estado anterior
+                if (movimentos[k] == vazioAnterior[i]) continue;
+                Nucleo::aplicarNoLugar(rascunho, movimentos[k], vazio);
+                if (Nucleo::verificarVitoria(rascunho)) {
+                    trabalho.pai_objetivo = (int)i;
+                    trabalho.movimento_objetivo = movimentos[k];
+                    break;
+                }
+                CandidatoFeixe c = { Nucleo::heuristica(rascunho, heuristica), (int)i, movimentos[k],
+                                     Nucleo::hashTabuleiro(rascunho) };
+                trabalho.candidatos.push_back(c);
+                Nucleo::aplicarNoLugar(rascunho, vazio, movimentos[k]);
+            }
+        }
+    }
+
+    // Threads da expansao paralela, criadas uma vez por busca. A cada camada a
+    // thread principal publica o feixe e abre uma nova rodada; cada thread
+    // expande o seu intervalo (trabalhos[t]), a principal expande o primeiro e
+    // espera a ultima terminar antes de juntar os candidatos.
+    class EquipeFeixe {
+    public:
+        EquipeFeixe(std::vector<TrabalhoFeixe>& trabalhos, int heuristica)
+            : trabalhos(trabalhos), heuristica(heuristica), feixe(nullptr), vazioAnterior(nullptr),
+              rodada(0), pendentes(0), encerrada(false) {
+            for (size_t t = 1; t < trabalhos.size(); ++t) {
+                threads.push_back(std::thread(&EquipeFeixe::executar, this, t));
+            }
+        }
+
+        ~EquipeFeixe() {
+            {
+                std::lock_guard<std::mutex> bloqueio(trava);
+                encerrada = true;
+            }
+            inicio.notify_all();
+            for (size_t t = 0; t < threads.size(); ++t) threads[t].join();
+        }
+
+        void expandir(const std::vector<Tabuleiro>& novoFeixe, const std::vector<int>& novoVazioAnterior) {
+            {
+                std::lock_guard<std::mutex> bloqueio(trava);
+                feixe = &novoFeixe;
+                vazioAnterior = &novoVazioAnterior;
+                pendentes = (int)threads.size();
+                rodada++;
+            }
+            inicio.notify_all();
+            expandirFeixe(novoFeixe, novoVazioAnterior, heuristica, trabalhos[0]);
+            std::unique_lock<std::mutex> bloqueio(trava);
+            fim.wait(bloqueio, [this]() { return pendentes == 0; });
+        }
+
+    private:
+        void executar(size_t t) {
+            long long vista = 0;
+            while (true) {
+                {
+                    std::unique_lock<std::mutex> bloqueio(trava);
+                    inicio.wait(bloqueio, [&]() { return encerrada || rodada != vista; });
+                    if (encerrada) return;
+                    vista = rodada;
+                }
+                // O feixe so muda depois que todas terminam a rodada
+                expandirFeixe(*feixe, *vazioAnterior, heuristica, trabalhos[t]);
+                std::lock_guard<std::mutex> bloqueio(trava);
+                if (--pendentes == 0) fim.notify_one();
+            }
+        }
+
+        std::vector<TrabalhoFeixe>& trabalhos;
+        int heuristica;
+        const std::vector<Tabuleiro>* feixe;
+        const std::vector<int>* vazioAnterior;
+        long long rodada;
+        int pendentes;
+        bool encerrada;
+        std::mutex trava;
+        std::condition_variable inicio;
+        std::condition_variable fim;
+        std::vector<std::thread> threads;
+    };
+
+    static SolverStats resolverFeixe(const Tabuleiro& inicial, int heuristica, const OpcoesSolver& opcoes) {
+        SolverStats stats;
+        auto start = Relogio::now();
+        int largura = std::max(1, opcoes.largura_feixe);
+        int janela = std::max(1, opcoes.janela_feixe);
+        Histograma histograma(opcoes.histograma);
+        long long nos_expandidos = 0;
+        long long nos_visitados = 0;
+        long long soma_ramificacao = 0;
+        long long total_nos = 0;
+        bool encontrou = false;
+
+        int numThreads = 1;
+        if (opcoes.feixe_paralelo) {
+            numThreads = opcoes.threads > 0 ? opcoes.threads : (int)std::thread::hardware_concurrency();
+            numThreads = std::max(1, std::min(numThreads, largura));
+        }
+
+        // Feixes das ultimas 'janela' camadas (a camada d fica em d % janela)
+        std::vector<std::vector<Tabuleiro> > feixes(janela);
+        std::vector<std::vector<uint64_t> > hashesFeixes(janela);
+        std::vector<Tabuleiro> proximo;
+        std::vector<int> vazioAnterior(1, -1), proximoVazioAnterior;
+        std::vector<std::vector<LigacaoFeixe> > camadas;
+        std::vector<TrabalhoFeixe> trabalhos(numThreads);
+        std::vector<CandidatoFeixe> candidatos; // buffer reaproveitado entre camadas
+        MapaPlano<uint64_t, int, HashIdentidade, AlocadorArena<char> > naCamada;       // hash -> indice em candidatos
+        MapaPlano<uint64_t, RefFeixe, HashIdentidade, AlocadorArena<char> > recentes; // estados da janela (evita ciclos)
+        candidatos.reserve((size_t)largura * 4);
+        naCamada.reservar((size_t)largura * 4);
+        recentes.reservar((size_t)largura * janela);
+        uint64_t hashInicial = Nucleo::hashTabuleiro(inicial);
+        feixes[0].push_back(inicial);
+        hashesFeixes[0].push_back(hashInicial);
+        RefFeixe refInicial = { 0, 0 };
+        recentes.inserir(hashInicial, refInicial, hashInicial);
+
+        std::unique_ptr<EquipeFeixe> equipe;
+        if (numThreads > 1) equipe.reset(new EquipeFeixe(trabalhos, heuristica));
+
+        int pai_objetivo = -1;
+        int movimento_objetivo = -1;
+        if (Nucleo::verificarVitoria(inicial)) encontrou = true;
+
+        TrechoRastreio camadaFeixe("camada do feixe", "busca", 0);
+        while (!encontrou && !estourouTimeout(start, opcoes.prazo)) {
+            int camadaAtual = (int)camadas.size();
+            const std::vector<Tabuleiro>& feixe = feixes[camadaAtual % janela];
+            if (feixe.empty()) break;
+            if (camadaAtual > 0) camadaFeixe.proximo((long long)camadaAtual);
+            // Expansao (opcionalmente em paralelo sobre partes do feixe)
+            size_t porThread = (feixe.size() + numThreads - 1) / numThreads;
+            for (int t = 0; t < numThreads; ++t) {
+                trabalhos[t].inicio = std::min(feixe.size(), t * porThread);
+                trabalhos[t].fim = std::min(feixe.size(), (t + 1) * porThread);
+            }
+            if (equipe && feixe.size() > 1) {
+                equipe->expandir(feixe, vazioAnterior);
+            } else {
+                trabalhos[0].inicio = 0;
+                trabalhos[0].fim = feixe.size();
+                expandirFeixe(feixe, vazioAnterior, heuristica, trabalhos[0]);
+                for (int t = 1; t < numThreads; ++t) {
+                    trabalhos[t].inicio = trabalhos[t].fim = 0;
+                    expandirFeixe(feixe, vazioAnterior, heuristica, trabalhos[t]);
+                }
+            }
+
+            nos_expandidos += (long long)feixe.size();
+            total_nos += (long long)feixe.size();
+            long long geradosCamada = 0;
+            candidatos.clear();
+            naCamada.clear();
+            for (int t = 0; t < numThreads; ++t) {
+                soma_ramificacao += trabalhos[t].ramificacao;
+                geradosCamada += trabalhos[t].ramificacao;
+                if (trabalhos[t].pai_objetivo >= 0 && pai_objetivo < 0) {
+                    pai_objetivo = trabalhos[t].pai_objetivo;
+                    movimento_objetivo = trabalhos[t].movimento_objetivo;
+                }
+                const std::vector<CandidatoFeixe>& gerados = trabalhos[t].candidatos;
+                for (size_t k = 0; k < gerados.size(); ++k) recentes.prebuscar(gerados[k].hash);
+                for (size_t k = 0; k < gerados.size(); ++k) {
+                    const CandidatoFeixe& c = gerados[k];
+                    // Hash igual so descarta o filho se o tabuleiro tambem for igual
+                    const RefFeixe* ref = recentes.procurar(c.hash, c.hash);
+                    if (ref && feixes[ref->camada % janela][ref->indice] ==
+                                   Nucleo::aplicarMovimento(feixe[c.pai], c.movimento)) {
+                        continue;
+                    }
+                    std::pair<int*, bool> r = naCamada.inserir(c.hash, (int)candidatos.size(), c.hash);
+                    if (!r.second) {
+                        const CandidatoFeixe& outro = candidatos[*r.first];
+                        if (Nucleo::aplicarMovimento(feixe[outro.pai], outro.movimento) ==
+                            Nucleo::aplicarMovimento(feixe[c.pai], c.movimento)) {
+                            continue;
+                        }
+                    }
+                    candidatos.push_back(c);
+                }
+            }
+            nos_visitados += (long long)candidatos.size();
+            // Duplicados: o movimento que desfaz o anterior e os estados ja vistos
+            histograma.somar(camadaAtual, (long long)feixe.size(), geradosCamada,
+                             geradosCamada - (long long)candidatos.size());
+
+            if (pai_objetivo >= 0) {
+                encontrou = true;
+                break;
+            }
+
+            // Selecao parcial dos melhores 'largura' candidatos
+            if ((int)candidatos.size() > largura) {
+                std::nth_element(candidatos.begin(), candidatos.begin() + largura, candidatos.end(), CompararCandidato());
+                candidatos.resize(largura);
+            }
+
+            proximo.clear();
+            proximoVazioAnterior.clear();
+            camadas.push_back(std::vector<LigacaoFeixe>());
+            std::vector<LigacaoFeixe>& camada = camadas.back();
+            camada.reserve(candidatos.size());
+            for (size_t k = 0; k < candidatos.size(); ++k) {
+                const CandidatoFeixe& c = candidatos[k];
+                proximoVazioAnterior.push_back(Nucleo::encontrarEspacoVazio(feixe[c.pai]));
+                proximo.push_back(Nucleo::aplicarMovimento(feixe[c.pai], c.movimento));
+                LigacaoFeixe ligacao = { c.pai, c.movimento };
+                camada.push_back(ligacao);
+            }
+
+            // A camada que sai da janela deixa de ser consultada; a nova ocupa o lugar dela
+            int novaCamada = camadaAtual + 1;
+            int lugar = novaCamada % janela;
+            std::vector<uint64_t>& hashes = hashesFeixes[lugar];
+            for (size_t i = 0; i < hashes.size(); ++i) {
+                const RefFeixe* ref = recentes.procurar(hashes[i], hashes[i]);
+                if (ref && ref->camada == novaCamada - janela && ref->indice == (int)i) {
+                    recentes.remover(hashes[i], hashes[i]);
+                }
+            }
+            hashes.clear();
+            for (size_t k = 0; k < candidatos.size(); ++k) {
+                RefFeixe ref = { novaCamada, (int)k };
+                recentes.inserir(candidatos[k].hash, ref, candidatos[k].hash);
+                hashes.push_back(candidatos[k].hash);
+            }
+            feixes[lugar].swap(proximo);
+            vazioAnterior.swap(proximoVazioAnterior);
+        }
+
+        if (encontrou && pai_objetivo >= 0) {
+            std::vector<int> caminho(1, movimento_objetivo);
+            int indice = pai_objetivo;
+            for (int d = (int)camadas.size() - 1; d >= 0; --d) {
+                caminho.push_back(camadas[d][indice].movimento);
+                indice = camadas[d][indice].pai;
+            }
+            std::reverse(caminho.begin(), caminho.end());
+            stats.caminho = CaminhoCompacto::deCaminho(Nucleo::encontrarEspacoVazio(inicial), caminho);
+        }
+        if (encontrou) {
+            stats.profundidade = (int)stats.caminho.size();
+            stats.custo = (int)stats.caminho.size();
+        }
+        finalizar(stats, encontrou, nos_expandidos, nos_visitados, soma_ramificacao, total_nos, start);
+        histograma.exportar(stats, "profundidade");
+        return stats;
+    }
+
+    // --- Pos-otimizacao de caminhos (para DFS, Backtracking e Gulosa) ---
+
+    // Ligacao de um estado na busca bidirecional: vizinho na direcao da
+    // origem (frente) ou do destino (tras) e o movimento que os liga.
+    struct Ligacao {
+        Chave vizinho;
+        int movimento;
+        int profundidade;
+    };
+    typedef MapaPlano<Chave, Ligacao, typename Nucleo::HashChave> MapaLigacoes;
+
+    static std::vector<Tabuleiro> estadosDoCaminho(const Tabuleiro& inicial, const std::vector<int>& caminho) {
+        std::vector<Tabuleiro> estados;
+        estados.reserve(caminho.size() + 1);
+        estados.push_back(inicial);
+        for (int movimento : caminho) {
+            estados.push_back(Nucleo::aplicarMovimento(estados.back(), movimento));
+        }
+        return estados;
+    }
+
+    // Remove ciclos: ao reencontrar um estado, descarta o trecho desde a primeira ocorrencia.
+    // O caminho tambem e cortado no primeiro estado objetivo alcancado.
+    static std::vector<int> removerCiclos(const Tabuleiro& inicial, const std::vector<int>& caminho) {
+        std::vector<int> resultado;
+        std::vector<Chave> chaves;
+        MapaIndices posicoes;
+        resultado.reserve(caminho.size());
+        chaves.reserve(caminho.size() + 1);
+        posicoes.reservar(caminho.size() + 1);
+
+        Tabuleiro atual = inicial;
+        chaves.push_back(Nucleo::chave(atual));
+        posicoes.inserir(chaves.back(), 0);
+        for (int movimento : caminho) {
+            atual = Nucleo::aplicarMovimento(atual, movimento);
+            Chave c = Nucleo::chave(atual);
+            const int* encontrado = posicoes.procurar(c);
+            if (encontrado) {
+                int primeira = *encontrado;
+                for (size_t k = primeira + 1; k < chaves.size(); ++k) posicoes.remover(chaves[k]);
+                chaves.resize(primeira + 1);
+                resultado.resize(primeira);
+            } else {
+                resultado.push_back(movimento);
+                chaves.push_back(c);
+                posicoes[c] = (int)resultado.size();
+                if (Nucleo::verificarVitoria(atual)) break;
+            }
+        }
+        return resultado;
+    }
+
+    // Expande uma camada inteira de um dos lados da busca bidirecional.
+    // Retorna a chave de encontro (se houver) em 'encontro'.
+    static bool expandirCamada(std::vector<Tabuleiro>& fronteira, MapaLigacoes& proprio, const MapaLigacoes& outro,
+                               bool frente, int& orcamentoNos, int limite, Chave& encontro) {
+        std::vector<Tabuleiro> proxima;
+        for (size_t i = 0; i < fronteira.size(); ++i) {
+            const Tabuleiro& tab = fronteira[i];
+            Chave chaveTab = Nucleo::chave(tab);
+            int profundidade = proprio[chaveTab].profundidade + 1;
+            int movimentos[4];
+            int q = Nucleo::movimentos(tab, movimentos);
+            for (int k = 0; k < q; ++k) {
+                Tabuleiro novo = Nucleo::aplicarMovimento(tab, movimentos[k]);
+                Chave c = Nucleo::chave(novo);
+                if (proprio.contem(c)) continue;
+                // Na direcao de tras, o movimento que leva 'novo' de volta a 'tab'
+                // e mover a ficha que ficou onde estava o vazio de 'tab'
+                Ligacao ligacao = { chaveTab, frente ? movimentos[k] : Nucleo::encontrarEspacoVazio(tab), profundidade };
+                proprio.inserir(c, ligacao);
+                const Ligacao* doOutroLado = outro.procurar(c);
+                if (doOutroLado && profundidade + doOutroLado->profundidade <= limite) {
+                    encontro = c;
+                    return true;
+                }
+                if (--orcamentoNos <= 0) return false;
+                proxima.push_back(novo);
+            }
+        }
+        fronteira.swap(proxima);
+        return false;
+    }
+
+    // Busca bidirecional limitada entre dois estados; 'atalho' recebe os movimentos
+    static bool buscarAtalho(const Tabuleiro& origem, const Tabuleiro& destino, int limite,
+                             int orcamentoNos, std::vector<int>& atalho) {
+        MapaLigacoes frente, tras;
+        Chave chaveOrigem = Nucleo::chave(origem);
+        Chave chaveDestino = Nucleo::chave(destino);
+        if (chaveOrigem == chaveDestino) {
+            atalho.clear();
+            return true;
+        }
+        Ligacao raizFrente = { chaveOrigem, -1, 0 };
+        Ligacao raizTras = { chaveDestino, -1, 0 };
+        frente.inserir(chaveOrigem, raizFrente);
+        tras.inserir(chaveDestino, raizTras);
+        std::vector<Tabuleiro> fronteiraFrente(1, origem), fronteiraTras(1, destino);
+        int profundidadeFrente = 0, profundidadeTras = 0;
+        Chave encontro = chaveOrigem;
+        bool achou = false;
+
+        while (!achou && profundidadeFrente + profundidadeTras < limite &&
+               !fronteiraFrente.empty() && !fronteiraTras.empty() && orcamentoNos > 0) {
+            // Expande sempre o lado com a menor fronteira
+            if (fronteiraFrente.size() <= fronteiraTras.size()) {
+                achou = expandirCamada(fronteiraFrente, frente, tras, true, orcamentoNos, limite, encontro);
+                profundidadeFrente++;
+            } else {
+                achou = expandirCamada(fronteiraTras, tras, frente, false, orcamentoNos, limite, encontro);
+                profundidadeTras++;
+            }
+        }
+        if (!achou) return false;
+
+        atalho.clear();
+        Chave c = encontro;
+        while (!(c == chaveOrigem)) {
+            const Ligacao& l = frente[c];
+            atalho.push_back(l.movimento);
+            c = l.vizinho;
+        }
+        std::reverse(atalho.begin(), atalho.end());
+        c = encontro;
+        while (!(c == chaveDestino)) {
+            const Ligacao& l = tras[c];
+            atalho.push_back(l.movimento);
+            c = l.vizinho;
+        }
+        return true;
+    }
+
+    static std::vector<int> otimizarCaminho(const Tabuleiro& inicial, const std::vector<int>& caminhoOriginal, double orcamento) {
+        const int JANELA = 16;
+        const int ORCAMENTO_NOS_POR_JANELA = 20000;
+        auto start = Relogio::now();
+
+        std::vector<int> caminho = removerCiclos(inicial, caminhoOriginal);
+        bool melhorou = true;
+        while (melhorou && !estourouTimeout(start, orcamento)) {
+            melhorou = false;
+            std::vector<Tabuleiro> estados = estadosDoCaminho(inicial, caminho);
+            std::vector<int> novo;
+            novo.reserve(caminho.size());
+            size_t i = 0;
+            while (i < caminho.size()) {
+                size_t j = std::min(i + JANELA, caminho.size());
+                std::vector<int> atalho;
+                if (j - i >= 2 && !estourouTimeout(start, orcamento) &&
+                    buscarAtalho(estados[i], estados[j], (int)(j - i) - 1, ORCAMENTO_NOS_POR_JANELA, atalho)) {
+                    novo.insert(novo.end(), atalho.begin(), atalho.end());
+                    i = j;
+                    melhorou = true;
+                } else {
+                    // Sem atalho: avanca meia janela para que as janelas se sobreponham
+                    size_t passo = std::min(i + JANELA / 2, caminho.size());
+                    novo.insert(novo.end(), caminho.begin() + i, caminho.begin() + passo);
+                    i = passo;
+                }
+            }
+            caminho = removerCiclos(inicial, novo);
+        }
+        return caminho;
+    }
+
+    static void otimizar(const std::vector<char>& tabuleiroInicial, SolverStats& stats, double orcamento) {
+        if (stats.caminho.empty()) return;
+        stats.caminho = CaminhoCompacto::deCaminho(
+            tabuleiroInicial, otimizarCaminho(Nucleo::deVetor(tabuleiroInicial), stats.caminho.paraCaminho(), orcamento));
+        stats.profundidade = (int)stats.caminho.size();
+        stats.custo = (int)stats.caminho.size();
+    }
+
+    // Ponto de entrada: os conteineres da busca pegam a memoria de uma arena
+    // (OpcoesSolver::arena), devolvida inteira quando a busca termina
+    static SolverStats resolver(const std::vector<char>& tabuleiroInicial, int algoritmo, int heuristica,
+                                const OpcoesSolver& opcoes) {
+        Tabuleiro inicial = Nucleo::deVetor(tabuleiroInicial);
+        Arena arena;
+        SolverStats stats;
+        {
+            EscopoArena escopo(opcoes.arena ? &arena : nullptr);
+            Estruturas e(capacidadeVisitados(inicial));
+            stats = executar(inicial, algoritmo, heuristica, opcoes, e);
+        }
+        exportarArena(arena, stats);
+        return stats;
+    }
+
+    static void exportarArena(const Arena& arena, SolverStats& stats) {
+        stats.arena_alocacoes = arena.numAlocacoes();
+        stats.arena_bytes_pedidos = arena.numBytesPedidos();
+        stats.arena_pico_bytes = arena.picoBytesReservados();
+        stats.arena_blocos = arena.numBlocos();
+    }
+
+    static SolverStats executar(const Tabuleiro& inicial, int algoritmo, int heuristica, const OpcoesSolver& opcoes,
+                                Estruturas& e) {
+        switch (algoritmo) {
+            case 2: return resolverBacktracking(inicial, TIMEOUT_PADRAO, opcoes);
+            case 3: return resolverDFS(inicial, TIMEOUT_PADRAO, opcoes, e);
+            case 4: return resolverUCS(inicial, opcoes, e);
+            case 5: return resolverMelhorPrimeiro(inicial, ORDEM_HEURISTICA, heuristica, opcoes, e);
+            case 6:
+                // Com algum movimento de custo 0 os trechos da busca de
+                // fronteira podem nao encurtar: usa o A* com lista de fechados
+                return opcoes.fronteira && opcoes.custos.custoMinimo() > 0
+                           ? resolverFronteira(inicial, heuristica, opcoes)
+                           : resolverMelhorPrimeiro(inicial, ORDEM_A_ESTRELA, heuristica, opcoes, e);
+            case 7: return resolverIDAStar(inicial, heuristica, opcoes, e);
+            case 8: return resolverARAStar(inicial, heuristica, opcoes);
+            case 9: return resolverFeixe(inicial, heuristica, opcoes);
+            case 1:
+            default:
+                return opcoes.fronteira ? resolverFronteira(inicial, 0, opcoes) : resolverBFS(inicial, opcoes, e);
+        }
+    }
+
+    // Estado de um SolverWorkspace para um tamanho de regua. As estruturas
+    // sao criadas fora de qualquer arena (usam o heap e duram o workspace);
+    // a arena so atende os conteineres locais dos outros algoritmos e e
+    // reiniciada, nao liberada, a cada busca.
+    class Espaco : public EspacoBusca {
+    public:
+        explicit Espaco(size_t tamanho) : estruturas(capacidadeVisitados(tamanho)) {}
+
+        SolverStats resolver(const char* tabuleiro, size_t tamanho, int algoritmo, int heuristica,
+                             const OpcoesSolver& opcoes) {
+            Tabuleiro inicial = Nucleo::deCelulas(tabuleiro, tamanho);
+            arena.reiniciar();
+            SolverStats stats;
+            {
+                EscopoArena escopo(opcoes.arena ? &arena : nullptr);
+                stats = executar(inicial, algoritmo, heuristica, opcoes, estruturas);
+            }
+            exportarArena(arena, stats);
+            return stats;
+        }
+
+    private:
+        Arena arena;
+        Estruturas estruturas;
+    };
+
+    static EspacoBusca* criarEspaco(size_t tamanho) { return new Espaco(tamanho); }
+};
+
+#endif
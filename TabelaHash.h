@@ -0,0 +1,293 @@
+#ifndef TABELA_HASH_H
+#define TABELA_HASH_H
+
+// Tabela hash de enderecamento aberto (sondagem linear com Robin Hood) usada
+// nos conjuntos de visitados e mapas de indices do solucionador.
+//
+// Diferente de std::unordered_set/map, nao ha um no alocado por entrada: as
+// chaves e valores ficam num vetor contiguo e, ao lado, um vetor de controle
+// com 2 bytes por posicao (distancia ate a posicao ideal + impressao digital
+// de 8 bits do hash). A sondagem compara primeiro o controle, de modo que a
+// chave so e lida (e comparada) quando a impressao digital bate.
+//
+// Com Robin Hood, uma entrada que esta mais longe da sua posicao ideal toma o
+// lugar de uma que esta mais perto; isso mantem as sequencias de sondagem
+// curtas e permite parar a busca assim que se encontra uma entrada "mais rica"
+// que a procurada. A remocao desloca as entradas seguintes para tras, sem
+// lapides.
+//
+// prebuscar() traz para o cache a posicao ideal de uma chave ja com o hash
+// calculado; as buscas calculam o hash de todos os filhos de uma expansao,
+// prebuscam todos e so entao consultam a tabela.
+//
+// Ponteiros devolvidos por procurar()/inserir() valem ate a proxima insercao
+// ou remocao.
+//
+// 'Alocador' (reassociado para cada vetor interno) permite pegar a memoria de
+// uma arena (AlocadorArena em Arena.h).
+
+#include <vector>
+#include <memory>
+#include <utility>
+#include <cstddef>
+#include <cstdint>
+
+template <class Chave, class Valor, class Hash, class Alocador = std::allocator<char> >
+class MapaPlano {
+public:
+    MapaPlano() : mascara(0), quantidade(0), limiteCarga(0) {}
+
+    explicit MapaPlano(size_t capacidadeInicial) : mascara(0), quantidade(0), limiteCarga(0) {
+        reservar(capacidadeInicial);
+    }
+
+    size_t size() const { return quantidade; }
+    bool empty() const { return quantidade == 0; }
+    size_t capacidade() const { return controle.size(); }
+
+    void clear() {
+        if (quantidade == 0) return;
+        for (size_t i = 0; i < controle.size(); ++i) {
+            if (controle[i] != 0) {
+                controle[i] = 0;
+                entradas[i] = Entrada();
+            }
+        }
+        quantidade = 0;
+    }
+
+    // Garante espaco para 'n' entradas sem crescer
+    void reservar(size_t n) {
+        size_t necessario = 8;
+        while (necessario * CARGA_MAXIMA_NUM / CARGA_MAXIMA_DEN < n) necessario *= 2;
+        if (necessario > controle.size()) redimensionar(necessario);
+    }
+
+    uint64_t hashDe(const Chave& chave) const { return (uint64_t)Hash()(chave); }
+
+    void prebuscar(uint64_t hash) const {
+#if defined(__GNUC__)
+        if (controle.empty()) return;
+        size_t pos = (size_t)hash & mascara;
+        __builtin_prefetch(&controle[pos]);
+        __builtin_prefetch(&entradas[pos]);
+#else
+        (void)hash;
+#endif
+    }
+
+    Valor* procurar(const Chave& chave) { return procurar(chave, hashDe(chave)); }
+    const Valor* procurar(const Chave& chave) const { return procurar(chave, hashDe(chave)); }
+
+    Valor* procurar(const Chave& chave, uint64_t hash) {
+        long pos = localizar(chave, hash);
+        return pos < 0 ? nullptr : &entradas[pos].valor;
+    }
+
+    const Valor* procurar(const Chave& chave, uint64_t hash) const {
+        long pos = localizar(chave, hash);
+        return pos < 0 ? nullptr : &entradas[pos].valor;
+    }
+
+    bool contem(const Chave& chave) const { return localizar(chave, hashDe(chave)) >= 0; }
+    bool contem(const Chave& chave, uint64_t hash) const { return localizar(chave, hash) >= 0; }
+
+    // Insere se a chave ainda nao existir. Retorna o valor guardado e se houve insercao.
+    std::pair<Valor*, bool> inserir(const Chave& chave, const Valor& valor) {
+        return inserir(chave, valor, hashDe(chave));
+    }
+
+    std::pair<Valor*, bool> inserir(const Chave& chave, const Valor& valor, uint64_t hash) {
+        if (quantidade + 1 > limiteCarga) redimensionar(controle.empty() ? 16 : controle.size() * 2);
+        while (true) {
+            size_t pos = (size_t)hash & mascara;
+            uint16_t impressao = impressaoDe(hash);
+            unsigned distancia = 1;
+            // Procura a chave; para na primeira posicao vazia ou "mais rica"
+            while (true) {
+                uint16_t c = controle[pos];
+                unsigned d = c & 0xff;
+                if (d < distancia) break;
+                if (d == distancia && (c & 0xff00) == impressao && entradas[pos].chave == chave) {
+                    return std::make_pair(&entradas[pos].valor, false);
+                }
+                pos = (pos + 1) & mascara;
+                distancia++;
+            }
+            if (distancia < DISTANCIA_MAXIMA) {
+                size_t destino = pos;
+                if (deslocar(pos, distancia, impressao, Entrada(chave, valor))) {
+                    quantidade++;
+                    return std::make_pair(&entradas[destino].valor, true);
+                }
+                // A chave ja entrou, mas alguma entrada empurrada ficou pendente
+                redimensionar(controle.size() * 2);
+                return std::make_pair(&entradas[localizar(chave, hash)].valor, true);
+            }
+            // Sequencia de sondagem longa demais: cresce e tenta de novo
+            redimensionar(controle.size() * 2);
+        }
+    }
+
+    Valor& operator[](const Chave& chave) { return *inserir(chave, Valor()).first; }
+
+    bool remover(const Chave& chave) { return remover(chave, hashDe(chave)); }
+
+    bool remover(const Chave& chave, uint64_t hash) {
+        long encontrado = localizar(chave, hash);
+        if (encontrado < 0) return false;
+        // Remocao com deslocamento para tras: as entradas seguintes que nao
+        // estao na posicao ideal recuam uma posicao
+        size_t pos = (size_t)encontrado;
+        size_t prox = (pos + 1) & mascara;
+        while ((controle[prox] & 0xff) > 1) {
+            controle[pos] = (uint16_t)(controle[prox] - 1);
+            entradas[pos] = std::move(entradas[prox]);
+            pos = prox;
+            prox = (prox + 1) & mascara;
+        }
+        controle[pos] = 0;
+        entradas[pos] = Entrada();
+        quantidade--;
+        return true;
+    }
+
+    // Percorre as entradas (ordem arbitraria)
+    template <class Funcao>
+    void paraCada(Funcao f) const {
+        for (size_t i = 0; i < controle.size(); ++i) {
+            if (controle[i] != 0) f(entradas[i].chave, entradas[i].valor);
+        }
+    }
+
+private:
+    // Carga maxima de 7/8; a distancia cabe no byte baixo do controle
+    static const size_t CARGA_MAXIMA_NUM = 7;
+    static const size_t CARGA_MAXIMA_DEN = 8;
+    static const unsigned DISTANCIA_MAXIMA = 255;
+
+    struct Entrada {
+        Chave chave;
+        Valor valor;
+        Entrada() : chave(), valor() {}
+        Entrada(const Chave& c, const Valor& v) : chave(c), valor(v) {}
+    };
+
+    // Impressao digital: 8 bits altos do hash (os baixos escolhem a posicao)
+    static uint16_t impressaoDe(uint64_t hash) { return (uint16_t)((hash >> 56) << 8); }
+
+    long localizar(const Chave& chave, uint64_t hash) const {
+        if (quantidade == 0) return -1;
+        size_t pos = (size_t)hash & mascara;
+        uint16_t impressao = impressaoDe(hash);
+        unsigned distancia = 1;
+        while (true) {
+            uint16_t c = controle[pos];
+            unsigned d = c & 0xff;
+            if (d < distancia) return -1;
+            if (d == distancia && (c & 0xff00) == impressao && entradas[pos].chave == chave) return (long)pos;
+            pos = (pos + 1) & mascara;
+            distancia++;
+        }
+    }
+
+    // Coloca a entrada em 'pos' e empurra as "mais ricas" para frente (Robin Hood).
+    // Retorna false se alguma distancia passar do limite; nesse caso a tabela
+    // fica consistente, mas sem a entrada que sobrou, e precisa ser refeita.
+    bool deslocar(size_t pos, unsigned distancia, uint16_t impressao, Entrada entrada) {
+        uint16_t atual = (uint16_t)(impressao | distancia);
+        while (true) {
+            uint16_t c = controle[pos];
+            if (c == 0) {
+                controle[pos] = atual;
+                entradas[pos] = std::move(entrada);
+                return true;
+            }
+            if ((c & 0xff) < (atual & 0xff)) {
+                std::swap(controle[pos], atual);
+                std::swap(entradas[pos], entrada);
+            }
+            pos = (pos + 1) & mascara;
+            if ((unsigned)(atual & 0xff) + 1 >= DISTANCIA_MAXIMA) {
+                pendente.push_back(std::move(entrada));
+                return false;
+            }
+            atual++;
+        }
+    }
+
+    void redimensionar(size_t novaCapacidade) {
+        VetorControle controleAntigo(controle.get_allocator());
+        VetorEntradas entradasAntigas(entradas.get_allocator());
+        controleAntigo.swap(controle);
+        entradasAntigas.swap(entradas);
+        controle.assign(novaCapacidade, 0);
+        entradas.resize(novaCapacidade);
+        mascara = novaCapacidade - 1;
+        limiteCarga = novaCapacidade * CARGA_MAXIMA_NUM / CARGA_MAXIMA_DEN;
+        quantidade = 0;
+
+        VetorEntradas reinserir(entradas.get_allocator());
+        reinserir.swap(pendente);
+        for (size_t i = 0; i < controleAntigo.size(); ++i) {
+            if (controleAntigo[i] != 0) reinserir.push_back(std::move(entradasAntigas[i]));
+        }
+        for (size_t i = 0; i < reinserir.size(); ++i) {
+            uint64_t hash = hashDe(reinserir[i].chave);
+            size_t pos = (size_t)hash & mascara;
+            unsigned distancia = 1;
+            while ((controle[pos] & 0xff) >= distancia) {
+                pos = (pos + 1) & mascara;
+                distancia++;
+            }
+            if (distancia >= DISTANCIA_MAXIMA || !deslocar(pos, distancia, impressaoDe(hash), std::move(reinserir[i]))) {
+                // Muito improvavel com um hash razoavel: dobra de novo
+                for (size_t k = i + 1; k < reinserir.size(); ++k) pendente.push_back(std::move(reinserir[k]));
+                if (distancia >= DISTANCIA_MAXIMA) pendente.push_back(std::move(reinserir[i]));
+                redimensionar(novaCapacidade * 2);
+                return;
+            }
+            quantidade++;
+        }
+    }
+
+    typedef std::vector<uint16_t, typename std::allocator_traits<Alocador>::template rebind_alloc<uint16_t> > VetorControle;
+    typedef std::vector<Entrada, typename std::allocator_traits<Alocador>::template rebind_alloc<Entrada> > VetorEntradas;
+
+    VetorControle controle;
+    VetorEntradas entradas;
+    VetorEntradas pendente; // entradas a reinserir no proximo redimensionamento
+    size_t mascara;
+    size_t quantidade;
+    size_t limiteCarga;
+};
+
+// Conjunto sobre o mesmo mapa, sem valor associado
+template <class Chave, class Hash, class Alocador = std::allocator<char> >
+class ConjuntoPlano {
+public:
+    ConjuntoPlano() {}
+    explicit ConjuntoPlano(size_t capacidadeInicial) : mapa(capacidadeInicial) {}
+
+    size_t size() const { return mapa.size(); }
+    bool empty() const { return mapa.empty(); }
+    void clear() { mapa.clear(); }
+    void reservar(size_t n) { mapa.reservar(n); }
+
+    uint64_t hashDe(const Chave& chave) const { return mapa.hashDe(chave); }
+    void prebuscar(uint64_t hash) const { mapa.prebuscar(hash); }
+
+    // Retorna true se a chave foi inserida (nao estava no conjunto)
+    bool inserir(const Chave& chave) { return mapa.inserir(chave, SemValor()).second; }
+    bool inserir(const Chave& chave, uint64_t hash) { return mapa.inserir(chave, SemValor(), hash).second; }
+    bool contem(const Chave& chave) const { return mapa.contem(chave); }
+    bool contem(const Chave& chave, uint64_t hash) const { return mapa.contem(chave, hash); }
+    bool remover(const Chave& chave) { return mapa.remover(chave); }
+    bool remover(const Chave& chave, uint64_t hash) { return mapa.remover(chave, hash); }
+
+private:
+    struct SemValor {};
+    MapaPlano<Chave, SemValor, Hash, Alocador> mapa;
+};
+
+#endif
@@ -0,0 +1,211 @@
+#include "TelaJogo.h"
+#include <iostream>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <io.h>
+#ifndef ENABLE_VIRTUAL_TERMINAL_PROCESSING
+#define ENABLE_VIRTUAL_TERMINAL_PROCESSING 0x0004
+#endif
+#else
+#include <unistd.h>
+#include <sys/ioctl.h>
+#endif
+
+static int numeroDeDigitos(int valor) {
+    int digitos = 1;
+    while (valor >= 10) {
+        valor /= 10;
+        digitos++;
+    }
+    return digitos;
+}
+
+// 'c' centralizado em 'largura' colunas
+static void anexarCentralizado(std::string& linha, char c, int largura) {
+    int antes = (largura - 1) / 2;
+    linha.append(antes, ' ');
+    linha += c;
+    linha.append(largura - 1 - antes, ' ');
+}
+
+TelaJogo::TelaJogo(std::ostream& saida) : saida(&saida), ansi(false), valida(false), inicioJanela(0) {
+    if (&saida != &std::cout) return;
+#ifdef _WIN32
+    HANDLE console = GetStdHandle(STD_OUTPUT_HANDLE);
+    DWORD modo = 0;
+    if (_isatty(_fileno(stdout)) && GetConsoleMode(console, &modo)) {
+        ansi = SetConsoleMode(console, modo | ENABLE_VIRTUAL_TERMINAL_PROCESSING) != 0;
+    }
+#else
+    ansi = isatty(STDOUT_FILENO) != 0;
+#endif
+}
+
+void TelaJogo::definirRodape(const std::vector<std::string>& linhas) {
+    rodape = linhas;
+}
+
+void TelaJogo::invalidar() {
+    valida = false;
+}
+
+int TelaJogo::larguraTerminal() const {
+#ifdef _WIN32
+    CONSOLE_SCREEN_BUFFER_INFO info;
+    if (GetConsoleScreenBufferInfo(GetStdHandle(STD_OUTPUT_HANDLE), &info)) {
+        return info.srWindow.Right - info.srWindow.Left + 1;
+    }
+#else
+    struct winsize tamanho;
+    if (ioctl(STDOUT_FILENO, TIOCGWINSZ, &tamanho) == 0 && tamanho.ws_col > 0) return tamanho.ws_col;
+#endif
+    const char* colunas = std::getenv("COLUMNS");
+    if (colunas && std::atoi(colunas) > 0) return std::atoi(colunas);
+    return 80;
+}
+
+// Mantem o vazio (e os pulos em volta dele) dentro da janela; fora disso a
+// janela fica parada, para que a tela nao role a cada movimento
+void TelaJogo::ajustarJanela(int tamanho, int vazio, int visiveis) {
+    int margem = std::min(2, (visiveis - 1) / 2);
+    if (vazio - margem < inicioJanela || vazio + margem >= inicioJanela + visiveis) {
+        inicioJanela = vazio - visiveis / 2;
+    }
+    inicioJanela = std::max(0, std::min(inicioJanela, tamanho - visiveis));
+}
+
+void TelaJogo::montarQuadro(const std::vector<char>& tabuleiro, int movimentos, const std::vector<int>& moviveis,
+                            const std::string& mensagem, const std::string& prompt, std::vector<std::string>& linhas) {
+    int tamanho = (int)tabuleiro.size();
+    int colunas = larguraTerminal();
+    int largura = numeroDeDigitos(std::max(0, tamanho - 1));
+
+    // Prefixo '<', '|', celulas de 'largura' + 1 colunas e sufixo '>'
+    int visiveis = std::max(1, (colunas - 3) / (largura + 1));
+    if (visiveis >= tamanho) {
+        visiveis = tamanho;
+        inicioJanela = 0;
+    } else {
+        int vazio = (int)(std::find(tabuleiro.begin(), tabuleiro.end(), '_') - tabuleiro.begin());
+        ajustarJanela(tamanho, vazio, visiveis);
+    }
+    int fim = inicioJanela + visiveis;
+
+    std::vector<char> jogavel(tamanho, 0);
+    for (int p : moviveis) {
+        if (p >= 0 && p < tamanho) jogavel[p] = 1;
+    }
+
+    linhas.clear();
+    char tmp[96];
+    if (visiveis < tamanho) {
+        std::snprintf(tmp, sizeof(tmp), "Tabuleiro atual (Movimentos: %d) [%d-%d de %d]",
+                      movimentos, inicioJanela, fim - 1, tamanho);
+    } else {
+        std::snprintf(tmp, sizeof(tmp), "Tabuleiro atual (Movimentos: %d)", movimentos);
+    }
+    linhas.push_back(tmp);
+
+    std::string borda = " +";
+    std::string celulas(1, inicioJanela > 0 ? '<' : ' ');
+    std::string indices = "  ";
+    std::string marcas = "  ";
+    celulas += '|';
+    for (int i = inicioJanela; i < fim; ++i) {
+        borda.append(largura, '-');
+        borda += '+';
+        anexarCentralizado(celulas, tabuleiro[i], largura);
+        celulas += '|';
+        std::snprintf(tmp, sizeof(tmp), "%*d ", largura, i);
+        indices += tmp;
+        anexarCentralizado(marcas, jogavel[i] ? '^' : ' ', largura);
+        marcas += ' ';
+    }
+    if (fim < tamanho) celulas += '>';
+    linhas.push_back(borda);
+    linhas.push_back(celulas);
+    linhas.push_back(borda);
+    linhas.push_back(indices);
+    linhas.push_back(marcas);
+
+    std::string jogaveis = "Posicoes jogaveis:";
+    for (int p : moviveis) {
+        std::snprintf(tmp, sizeof(tmp), " %d", p);
+        jogaveis += tmp;
+    }
+    linhas.push_back(jogaveis);
+    linhas.push_back("");
+    linhas.insert(linhas.end(), rodape.begin(), rodape.end());
+    linhas.push_back(mensagem);
+    linhas.push_back(prompt);
+
+    // Linhas que quebrassem no terminal desalinhariam o posicionamento do cursor
+    for (size_t i = 0; i < linhas.size(); ++i) {
+        if ((int)linhas[i].size() >= colunas) linhas[i].resize(std::max(0, colunas - 1));
+    }
+}
+
+void TelaJogo::anexarPosicionamento(int linha, int coluna) {
+    char tmp[32];
+    std::snprintf(tmp, sizeof(tmp), "\x1b[%d;%dH", linha, coluna);
+    buffer += tmp;
+}
+
+void TelaJogo::desenhar(const std::vector<char>& tabuleiro, int movimentos, const std::vector<int>& moviveis,
+                        const std::string& mensagem, const std::string& prompt) {
+    std::vector<std::string> linhas;
+    montarQuadro(tabuleiro, movimentos, moviveis, mensagem, prompt, linhas);
+    buffer.clear();
+
+    if (!ansi) {
+        buffer += '\n';
+        for (size_t i = 0; i + 1 < linhas.size(); ++i) {
+            buffer += linhas[i];
+            buffer += '\n';
+        }
+        buffer += linhas.back();
+    } else {
+        if (!valida) {
+            buffer += "\x1b[2J\x1b[H";
+            anterior.clear();
+        }
+        // Reescreve cada linha so a partir da primeira coluna que mudou
+        for (size_t i = 0; i < linhas.size(); ++i) {
+            const std::string& nova = linhas[i];
+            if (i < anterior.size() && anterior[i] == nova) continue;
+            size_t comum = 0;
+            if (i < anterior.size()) {
+                const std::string& velha = anterior[i];
+                while (comum < nova.size() && comum < velha.size() && nova[comum] == velha[comum]) comum++;
+            }
+            anexarPosicionamento((int)i + 1, (int)comum + 1);
+            buffer.append(nova, comum, std::string::npos);
+            buffer += "\x1b[K";
+        }
+        // Cursor no fim do prompt; apaga o que foi digitado e o resto da tela
+        anexarPosicionamento((int)linhas.size(), (int)linhas.back().size() + 1);
+        buffer += "\x1b[J";
+        anterior.swap(linhas);
+        valida = true;
+    }
+    saida->write(buffer.data(), (std::streamsize)buffer.size());
+    saida->flush();
+}
+
+void TelaJogo::sairDoQuadro() {
+    if (ansi && valida) {
+        buffer.clear();
+        anexarPosicionamento((int)anterior.size() + 1, 1);
+        buffer += "\x1b[J";
+        saida->write(buffer.data(), (std::streamsize)buffer.size());
+        // O que for escrito depois pode rolar a tela
+        valida = false;
+    } else {
+        *saida << '\n';
+    }
+    saida->flush();
+}
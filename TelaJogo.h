@@ -0,0 +1,55 @@
+#ifndef TELAJOGO_H
+#define TELAJOGO_H
+
+#include <vector>
+#include <string>
+#include <ostream>
+
+// Tela do jogo interativo no terminal.
+//
+// Cada quadro e montado como uma lista de linhas e comparado com o quadro
+// anterior; so o trecho de cada linha que mudou e reescrito, com posicionamento
+// de cursor ANSI, e tudo sai numa unica escrita. A tela so e apagada por
+// inteiro no primeiro quadro (ou depois de invalidar()).
+//
+// Reguas mais largas que o terminal sao mostradas numa janela que acompanha o
+// espaco vazio; '<' e '>' indicam que ha mais posicoes fora da janela. As
+// celulas tem a largura do maior indice, para que posicoes com varios digitos
+// fiquem alinhadas.
+//
+// Se a saida nao for um terminal, cada quadro e escrito por inteiro, sem
+// codigos de controle.
+class TelaJogo {
+public:
+    explicit TelaJogo(std::ostream& saida);
+
+    void definirRodape(const std::vector<std::string>& linhas);
+
+    // Desenha o tabuleiro; 'moviveis' sao as posicoes que podem ser jogadas.
+    // O cursor fica no fim da linha 'prompt', a ultima do quadro.
+    void desenhar(const std::vector<char>& tabuleiro, int movimentos, const std::vector<int>& moviveis,
+                  const std::string& mensagem, const std::string& prompt);
+
+    // Leva o cursor para baixo do quadro (antes de escrever fora da tela)
+    void sairDoQuadro();
+
+    // O proximo quadro apaga a tela e e desenhado por inteiro
+    void invalidar();
+
+private:
+    int larguraTerminal() const;
+    void ajustarJanela(int tamanho, int vazio, int visiveis);
+    void montarQuadro(const std::vector<char>& tabuleiro, int movimentos, const std::vector<int>& moviveis,
+                      const std::string& mensagem, const std::string& prompt, std::vector<std::string>& linhas);
+    void anexarPosicionamento(int linha, int coluna);
+
+    std::ostream* saida;
+    bool ansi;
+    bool valida;               // 'anterior' corresponde ao que esta na tela
+    int inicioJanela;          // primeira posicao visivel
+    std::vector<std::string> anterior;
+    std::vector<std::string> rodape;
+    std::string buffer;
+};
+
+#endif
@@ -0,0 +1,740 @@
+// Medicao de desempenho dos algoritmos e historico de regressoes.
+//
+//   regua_bench executar [opcoes]   mede e acrescenta as amostras ao historico
+//   regua_bench comparar [opcoes]   compara um commit com uma base
+//   regua_bench varrer [opcoes]     curvas de crescimento de n = 2 ate --max-n
+//   regua_bench heuristicas [opcoes] qualidade das heuristicas contra a distancia exata
+//
+// Cada linha do historico (CSV) e uma amostra: o tempo total para resolver
+// todos os tabuleiros de um conjunto com um algoritmo. As amostras sao
+// agrupadas pela chave (compilador, flags, algoritmo, heuristica, n, conjunto)
+// e comparadas entre commits com o teste de Mann-Whitney unilateral (a versao
+// atual e mais lenta?). 'comparar' termina com codigo 1 se alguma chave ficou
+// mais lenta que o limiar com significancia estatistica.
+//
+// Com '--workspace sim' os tabuleiros sao resolvidos por um SolverWorkspace
+// (estruturas reaproveitadas); as amostras ficam com o conjunto marcado com
+// "+workspace", numa chave separada.
+//
+// 'varrer' roda cada combinacao familia x algoritmo x heuristica para n = 2,
+// 3, ... e para a serie no primeiro n em que o tempo medio por tabuleiro passa
+// de --tempo ou a arena da busca passa de --memoria (OpcoesSolver::limite_memoria),
+// ou em que algum tabuleiro fica sem solucao. As curvas vao para --saida e as
+// taxas de crescimento (ajuste de log(y) = a + b n nos ultimos pontos viaveis;
+// fator = e^b por ficha a mais) para --ajuste.
+//
+// 'heuristicas' calcula a distancia exata h* de todos os tabuleiros de --n
+// fichas (busca em largura paralela a partir do objetivo) e compara cada
+// heuristica com ela: razao media h/h*, superestimativas (quantas e de
+// quanto), correlacao e a economia prevista do A* nos tabuleiros invertido e
+// intercalado. A previsao conta os tabuleiros com g + h < C* (g = distancia
+// exata a partir do inicial, C* = custo otimo), que o A* expande com qualquer
+// heuristica consistente; na busca cega (h = 0) sao os com g < C*. A media de
+// h por distancia vai para --saida.
+
+#include "Solver.h"
+#include "Gerador.h"
+#include "Rastreio.h"
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <map>
+#include <set>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <ctime>
+#include <atomic>
+#include <thread>
+
+using namespace std;
+
+const char* const ARQUIVO_HISTORICO_PADRAO = "bench_historico.csv";
+const char* const CABECALHO_HISTORICO =
+    "data,commit,compilador,flags,algoritmo,heuristica,n,conjunto,repeticao,tempo_s,nos_expandidos";
+
+struct Amostra {
+    string data;
+    string commit;
+    string compilador;
+    string flags;
+    int algoritmo;
+    int heuristica;
+    int n;
+    string conjunto;
+    int repeticao;
+    double tempo;
+    long long nos_expandidos;
+
+    // Tudo o que identifica a medicao, menos o commit
+    string chave() const {
+        ostringstream s;
+        s << compilador << " | " << flags << " | alg " << algoritmo << " | h " << heuristica
+          << " | n " << n << " | " << conjunto;
+        return s.str();
+    }
+};
+
+string nomeCompilador() {
+#if defined(__clang__)
+    return string("clang ") + __clang_version__;
+#elif defined(__GNUC__)
+    return string("g++ ") + __VERSION__;
+#elif defined(_MSC_VER)
+    return "msvc " + to_string(_MSC_VER);
+#else
+    return "desconhecido";
+#endif
+}
+
+// Virgulas e quebras de linha nao podem aparecer dentro de um campo
+string limparCampo(string campo) {
+    for (char& c : campo) {
+        if (c == ',' || c == '\n' || c == '\r') c = ';';
+    }
+    return campo;
+}
+
+vector<int> lerLista(const string& texto) {
+    vector<int> valores;
+    stringstream s(texto);
+    string item;
+    while (getline(s, item, ',')) {
+        if (!item.empty()) valores.push_back(atoi(item.c_str()));
+    }
+    return valores;
+}
+
+// Conjunto "aleatorio:semente:quantidade" (GeradorTabuleiros) ou "padrao" (A..A_B..B)
+bool montarConjunto(const string& descricao, int n, vector<vector<char> >& tabuleiros) {
+    tabuleiros.clear();
+    if (descricao == "padrao") {
+        tabuleiros.push_back(GeradorTabuleiros::invertido(n));
+        return true;
+    }
+    unsigned long long semente = 0;
+    int quantidade = 0;
+    char resto[2];
+    if (sscanf(descricao.c_str(), "aleatorio:%llu:%d%1s", &semente, &quantidade, resto) != 2 || quantidade < 1) {
+        return false;
+    }
+    GeradorTabuleiros gerador(n, semente);
+    for (int i = 0; i < quantidade; ++i) tabuleiros.push_back(gerador.sortear());
+    return true;
+}
+
+bool lerHistorico(const string& arquivo, vector<Amostra>& amostras) {
+    ifstream entrada(arquivo.c_str());
+    if (!entrada) return false;
+    string linha;
+    while (getline(entrada, linha)) {
+        if (linha.empty() || linha.compare(0, 5, "data,") == 0) continue;
+        vector<string> campos;
+        stringstream s(linha);
+        string campo;
+        while (getline(s, campo, ',')) campos.push_back(campo);
+        if (campos.size() != 11) continue;
+        Amostra a;
+        a.data = campos[0];
+        a.commit = campos[1];
+        a.compilador = campos[2];
+        a.flags = campos[3];
+        a.algoritmo = atoi(campos[4].c_str());
+        a.heuristica = atoi(campos[5].c_str());
+        a.n = atoi(campos[6].c_str());
+        a.conjunto = campos[7];
+        a.repeticao = atoi(campos[8].c_str());
+        a.tempo = atof(campos[9].c_str());
+        a.nos_expandidos = atoll(campos[10].c_str());
+        amostras.push_back(a);
+    }
+    return true;
+}
+
+int executar(const map<string, string>& opcoes) {
+    string arquivo = opcoes.count("historico") ? opcoes.at("historico") : ARQUIVO_HISTORICO_PADRAO;
+    string commit = opcoes.count("commit") ? opcoes.at("commit") : "desconhecido";
+    string flags = opcoes.count("flags") ? opcoes.at("flags") : "";
+    string conjunto = opcoes.count("conjunto") ? opcoes.at("conjunto") : "aleatorio:1:10";
+    vector<int> algoritmos = lerLista(opcoes.count("algoritmos") ? opcoes.at("algoritmos") : "1,4,5,6,8,9,10");
+    vector<int> tamanhos = lerLista(opcoes.count("n") ? opcoes.at("n") : "6,8");
+    int heuristica = opcoes.count("heuristica") ? atoi(opcoes.at("heuristica").c_str()) : 3;
+    int repeticoes = opcoes.count("repeticoes") ? atoi(opcoes.at("repeticoes").c_str()) : 7;
+    if (repeticoes < 1) repeticoes = 1;
+    string rastreio = opcoes.count("rastreio") ? opcoes.at("rastreio") : "";
+    if (!rastreio.empty()) Rastreio::ativar(true);
+    bool usarWorkspace = opcoes.count("workspace") && opcoes.at("workspace") == "sim";
+    string nomeConjunto = usarWorkspace ? conjunto + "+workspace" : conjunto;
+
+    ifstream existente(arquivo.c_str());
+    bool novo = !existente.good();
+    existente.close();
+    ofstream saida(arquivo.c_str(), ios::out | ios::app);
+    if (!saida) {
+        cerr << "Nao foi possivel escrever em " << arquivo << "\n";
+        return 2;
+    }
+    if (novo) saida << CABECALHO_HISTORICO << "\n";
+
+    char data[32];
+    time_t agora = time(0);
+    strftime(data, sizeof(data), "%Y-%m-%dT%H:%M:%S", localtime(&agora));
+    string compilador = limparCampo(nomeCompilador());
+    flags = limparCampo(flags);
+    commit = limparCampo(commit);
+
+    for (int n : tamanhos) {
+        vector<vector<char> > tabuleiros;
+        if (!montarConjunto(conjunto, n, tabuleiros)) {
+            cerr << "Conjunto invalido: " << conjunto << " (use 'padrao' ou 'aleatorio:semente:quantidade')\n";
+            return 2;
+        }
+        SolverWorkspace workspace(n);
+        for (int alg : algoritmos) {
+            cout << "n=" << n << " algoritmo " << alg << ":" << flush;
+            for (int r = 0; r < repeticoes; ++r) {
+                long long nos = 0;
+                auto inicio = chrono::high_resolution_clock::now();
+                for (const vector<char>& t : tabuleiros) {
+                    SolverStats stats = usarWorkspace ? workspace.resolver(t.data(), t.size(), alg, heuristica)
+                                                      : Solver::resolver(t, alg, heuristica);
+                    nos += stats.nos_expandidos;
+                }
+                double tempo = chrono::duration<double>(chrono::high_resolution_clock::now() - inicio).count();
+                saida << data << ',' << commit << ',' << compilador << ',' << flags << ',' << alg << ','
+                      << heuristica << ',' << n << ',' << nomeConjunto << ',' << r << ','
+                      << setprecision(9) << tempo << ',' << nos << "\n";
+                cout << " " << fixed << setprecision(4) << tempo << flush;
+                cout.unsetf(ios::fixed);
+            }
+            cout << "\n";
+        }
+    }
+    cout << "Amostras acrescentadas a " << arquivo << " (commit " << commit << ")\n";
+    if (!rastreio.empty()) {
+        if (!Rastreio::gravar(rastreio)) {
+            cerr << "Nao foi possivel escrever em " << rastreio << "\n";
+            return 2;
+        }
+        cout << "Rastreio gravado em " << rastreio << "\n";
+    }
+    return 0;
+}
+
+double mediana(vector<double> v) {
+    sort(v.begin(), v.end());
+    size_t m = v.size() / 2;
+    return v.size() % 2 ? v[m] : (v[m - 1] + v[m]) / 2.0;
+}
+
+// Mann-Whitney unilateral: probabilidade de 'atual' nao ser maior que 'base'.
+// Aproximacao normal com correcao para empates e de continuidade.
+double valorPMannWhitney(const vector<double>& base, const vector<double>& atual) {
+    vector<pair<double, int> > todos;
+    for (double x : base) todos.push_back(make_pair(x, 0));
+    for (double y : atual) todos.push_back(make_pair(y, 1));
+    sort(todos.begin(), todos.end());
+    double N = (double)todos.size();
+    double somaPostosAtual = 0.0;
+    double correcaoEmpates = 0.0;
+    for (size_t i = 0; i < todos.size();) {
+        size_t j = i;
+        while (j < todos.size() && todos[j].first == todos[i].first) ++j;
+        double postoMedio = (i + 1 + j) / 2.0; // postos i+1..j
+        for (size_t k = i; k < j; ++k) {
+            if (todos[k].second == 1) somaPostosAtual += postoMedio;
+        }
+        double t = (double)(j - i);
+        correcaoEmpates += t * t * t - t;
+        i = j;
+    }
+    double nb = (double)base.size(), na = (double)atual.size();
+    double u = somaPostosAtual - na * (na + 1) / 2.0;
+    double media = nb * na / 2.0;
+    double variancia = nb * na / 12.0 * ((N + 1) - correcaoEmpates / (N * (N - 1)));
+    if (variancia <= 0.0) return 1.0;
+    double z = (u - media - 0.5) / sqrt(variancia);
+    return 0.5 * erfc(z / sqrt(2.0));
+}
+
+int comparar(const map<string, string>& opcoes) {
+    string arquivo = opcoes.count("historico") ? opcoes.at("historico") : ARQUIVO_HISTORICO_PADRAO;
+    double limiar = opcoes.count("limiar") ? atof(opcoes.at("limiar").c_str()) : 0.05;
+    double alfa = opcoes.count("alfa") ? atof(opcoes.at("alfa").c_str()) : 0.05;
+    vector<Amostra> amostras;
+    if (!lerHistorico(arquivo, amostras) || amostras.empty()) {
+        cerr << "Historico vazio ou inexistente: " << arquivo << "\n";
+        return 2;
+    }
+
+    // Commits na ordem em que aparecem; por padrao o ultimo contra o penultimo
+    vector<string> commits;
+    for (const Amostra& a : amostras) {
+        if (find(commits.begin(), commits.end(), a.commit) == commits.end()) commits.push_back(a.commit);
+    }
+    string atual = opcoes.count("atual") && !opcoes.at("atual").empty() ? opcoes.at("atual") : commits.back();
+    string base;
+    if (opcoes.count("base") && !opcoes.at("base").empty()) {
+        base = opcoes.at("base");
+    } else {
+        for (size_t i = commits.size(); i-- > 0;) {
+            if (commits[i] != atual) {
+                base = commits[i];
+                break;
+            }
+        }
+    }
+    if (base.empty() || base == atual) {
+        cerr << "Nao ha um commit base para comparar com " << atual << "\n";
+        return 2;
+    }
+
+    map<string, pair<vector<double>, vector<double> > > grupos;
+    for (const Amostra& a : amostras) {
+        if (a.commit == base) grupos[a.chave()].first.push_back(a.tempo);
+        else if (a.commit == atual) grupos[a.chave()].second.push_back(a.tempo);
+    }
+
+    cout << "Base: " << base << "  Atual: " << atual << "  (limiar " << limiar * 100 << "%, alfa " << alfa << ")\n\n";
+    int regressoes = 0;
+    int comparadas = 0;
+    for (const auto& g : grupos) {
+        const vector<double>& b = g.second.first;
+        const vector<double>& a = g.second.second;
+        if (b.size() < 2 || a.size() < 2) continue;
+        comparadas++;
+        double mb = mediana(b), ma = mediana(a);
+        double variacao = mb > 0.0 ? ma / mb - 1.0 : 0.0;
+        double p = valorPMannWhitney(b, a);
+        const char* situacao = "ok";
+        if (variacao > limiar && p < alfa) {
+            situacao = "REGRESSAO";
+            regressoes++;
+        } else if (variacao < -limiar && valorPMannWhitney(a, b) < alfa) {
+            situacao = "melhora";
+            p = valorPMannWhitney(a, b);
+        }
+        cout << left << setw(12) << situacao << g.first << "\n"
+             << "            mediana " << fixed << setprecision(6) << mb << " s -> " << ma << " s ("
+             << showpos << setprecision(1) << variacao * 100 << "%" << noshowpos
+             << ", p = " << setprecision(4) << p << ")\n";
+        cout.unsetf(ios::fixed);
+    }
+    if (comparadas == 0) {
+        cerr << "Nenhuma chave com pelo menos 2 amostras nos dois commits\n";
+        return 2;
+    }
+    cout << "\n" << regressoes << " regressao(oes) em " << comparadas << " chave(s)\n";
+    return regressoes > 0 ? 1 : 0;
+}
+
+// Tabuleiros de uma familia para n fichas de cada cor
+bool tabuleirosDaFamilia(const string& familia, int n, int amostras, unsigned long long semente,
+                         vector<vector<char> >& tabuleiros) {
+    tabuleiros.clear();
+    if (familia == "intercalado") {
+        tabuleiros.push_back(GeradorTabuleiros::intercalado(n));
+    } else if (familia == "invertido") {
+        tabuleiros.push_back(GeradorTabuleiros::invertido(n));
+    } else if (familia == "aleatorio") {
+        GeradorTabuleiros gerador(n, semente + (unsigned long long)n);
+        for (int i = 0; i < amostras; ++i) tabuleiros.push_back(gerador.sortear());
+    } else {
+        return false;
+    }
+    return true;
+}
+
+struct PontoVarredura {
+    int n;
+    int tabuleiros;
+    int resolvidos;
+    double tempo;      // media por tabuleiro (s)
+    double tempo_cpu;
+    double expandidos; // media por tabuleiro
+    long long memoria; // maior pico da arena (bytes)
+    string situacao;   // ok, tempo, memoria ou falhou
+};
+
+// Minimos quadrados de log(y) = a + b n; devolve e^b e o R^2 (fator 0 sem pontos suficientes)
+void ajustarCrescimento(const vector<double>& ns, const vector<double>& ys, double& fator, double& r2) {
+    fator = 0.0;
+    r2 = 0.0;
+    vector<double> x, y;
+    for (size_t i = 0; i < ys.size(); ++i) {
+        if (ys[i] > 0.0) {
+            x.push_back(ns[i]);
+            y.push_back(log(ys[i]));
+        }
+    }
+    if (x.size() < 2) return;
+    double mx = 0.0, my = 0.0;
+    for (size_t i = 0; i < x.size(); ++i) {
+        mx += x[i];
+        my += y[i];
+    }
+    mx /= x.size();
+    my /= y.size();
+    double sxy = 0.0, sxx = 0.0, syy = 0.0;
+    for (size_t i = 0; i < x.size(); ++i) {
+        sxy += (x[i] - mx) * (y[i] - my);
+        sxx += (x[i] - mx) * (x[i] - mx);
+        syy += (y[i] - my) * (y[i] - my);
+    }
+    if (sxx == 0.0) return;
+    double b = sxy / sxx;
+    fator = exp(b);
+    r2 = syy > 0.0 ? (sxy * sxy) / (sxx * syy) : 1.0;
+}
+
+int varrer(const map<string, string>& opcoes) {
+    int maxN = opcoes.count("max-n") ? atoi(opcoes.at("max-n").c_str()) : 12;
+    vector<int> algoritmos = lerLista(opcoes.count("algoritmos") ? opcoes.at("algoritmos") : "1,2,3,4,5,6,7,8,9,10");
+    vector<int> heuristicas = lerLista(opcoes.count("heuristicas") ? opcoes.at("heuristicas") : "1,2,3");
+    string textoFamilias = opcoes.count("familias") ? opcoes.at("familias") : "intercalado,invertido,aleatorio";
+    int amostras = opcoes.count("amostras") ? atoi(opcoes.at("amostras").c_str()) : 5;
+    unsigned long long semente = opcoes.count("semente") ? strtoull(opcoes.at("semente").c_str(), 0, 10) : 1;
+    double corteTempo = opcoes.count("tempo") ? atof(opcoes.at("tempo").c_str()) : 2.0;
+    double corteMemoriaMB = opcoes.count("memoria") ? atof(opcoes.at("memoria").c_str()) : 512.0;
+    int pontosAjuste = opcoes.count("pontos-ajuste") ? atoi(opcoes.at("pontos-ajuste").c_str()) : 5;
+    string arquivoCurvas = opcoes.count("saida") ? opcoes.at("saida") : "varredura.csv";
+    string arquivoAjuste = opcoes.count("ajuste") ? opcoes.at("ajuste") : "varredura_ajuste.csv";
+    if (amostras < 1) amostras = 1;
+    if (pontosAjuste < 2) pontosAjuste = 2;
+
+    vector<string> familias;
+    stringstream lista(textoFamilias);
+    string familia;
+    vector<vector<char> > tabuleiros;
+    while (getline(lista, familia, ',')) {
+        if (familia.empty()) continue;
+        if (!tabuleirosDaFamilia(familia, 2, 1, semente, tabuleiros)) {
+            cerr << "Familia invalida: " << familia << " (use intercalado, invertido ou aleatorio)\n";
+            return 2;
+        }
+        familias.push_back(familia);
+    }
+
+    ofstream curvas(arquivoCurvas.c_str(), ios::out | ios::trunc);
+    ofstream ajuste(arquivoAjuste.c_str(), ios::out | ios::trunc);
+    if (!curvas || !ajuste) {
+        cerr << "Nao foi possivel escrever em " << (!curvas ? arquivoCurvas : arquivoAjuste) << "\n";
+        return 2;
+    }
+    curvas << "familia,algoritmo,heuristica,n,tabuleiros,resolvidos,tempo_s,tempo_cpu_s,nos_expandidos,"
+              "memoria_bytes,situacao\n";
+    ajuste << "familia,algoritmo,heuristica,n_viavel,parada,fator_tempo,r2_tempo,fator_expandidos,"
+              "r2_expandidos,fator_memoria,r2_memoria\n";
+
+    OpcoesSolver opcoesSolver;
+    opcoesSolver.limite_memoria = (size_t)(corteMemoriaMB * 1024 * 1024);
+    opcoesSolver.prazo = corteTempo; // ARA*, feixe e fronteira param sozinhos no corte
+
+    cout << left << setw(12) << "familia" << setw(5) << "alg" << setw(3) << "h" << setw(9) << "n viavel"
+         << setw(9) << "parada" << setw(12) << "x tempo" << setw(12) << "x expand." << "x memoria\n";
+    for (const string& fam : familias) {
+        for (int alg : algoritmos) {
+            // A heuristica so importa para Gulosa, A*, IDA*, ARA* e Feixe
+            bool heuristico = alg >= 5 && alg <= 9;
+            vector<int> hs = heuristico ? heuristicas : vector<int>(1, 0);
+            for (int h : hs) {
+                vector<PontoVarredura> pontos;
+                string parada = "max-n";
+                for (int n = 2; n <= maxN; ++n) {
+                    tabuleirosDaFamilia(fam, n, amostras, semente, tabuleiros);
+                    PontoVarredura p = { n, 0, 0, 0.0, 0.0, 0.0, 0, "ok" };
+                    for (const vector<char>& t : tabuleiros) {
+                        SolverStats stats = Solver::resolver(t, alg, h, opcoesSolver);
+                        p.tabuleiros++;
+                        p.tempo += stats.tempo_execucao;
+                        p.tempo_cpu += stats.tempo_cpu;
+                        p.expandidos += (double)stats.nos_expandidos;
+                        p.memoria = max(p.memoria, stats.arena_pico_bytes);
+                        if (stats.profundidade >= 0) p.resolvidos++;
+                        if (stats.memoria_esgotada) p.situacao = "memoria";
+                        else if (stats.profundidade < 0) p.situacao = stats.tempo_execucao >= corteTempo ? "tempo" : "falhou";
+                        else if (p.tempo / p.tabuleiros > corteTempo) p.situacao = "tempo";
+                        if (p.situacao != "ok") break;
+                    }
+                    p.tempo /= p.tabuleiros;
+                    p.tempo_cpu /= p.tabuleiros;
+                    p.expandidos /= p.tabuleiros;
+                    pontos.push_back(p);
+                    curvas << fam << ',' << alg << ',' << h << ',' << n << ',' << p.tabuleiros << ',' << p.resolvidos
+                           << ',' << setprecision(9) << p.tempo << ',' << p.tempo_cpu << ',' << p.expandidos << ','
+                           << p.memoria << ',' << p.situacao << "\n";
+                    if (p.situacao != "ok") {
+                        parada = p.situacao;
+                        break;
+                    }
+                }
+                curvas.flush();
+
+                // Ajuste nos ultimos pontos viaveis (o inicio da curva e dominado por custos fixos)
+                vector<double> ns, tempos, expandidos, memorias;
+                for (const PontoVarredura& p : pontos) {
+                    if (p.situacao != "ok") continue;
+                    ns.push_back(p.n);
+                    tempos.push_back(p.tempo);
+                    expandidos.push_back(p.expandidos);
+                    memorias.push_back((double)p.memoria);
+                }
+                size_t inicio = ns.size() > (size_t)pontosAjuste ? ns.size() - pontosAjuste : 0;
+                ns.erase(ns.begin(), ns.begin() + inicio);
+                tempos.erase(tempos.begin(), tempos.begin() + inicio);
+                expandidos.erase(expandidos.begin(), expandidos.begin() + inicio);
+                memorias.erase(memorias.begin(), memorias.begin() + inicio);
+                double fT, r2T, fE, r2E, fM, r2M;
+                ajustarCrescimento(ns, tempos, fT, r2T);
+                ajustarCrescimento(ns, expandidos, fE, r2E);
+                ajustarCrescimento(ns, memorias, fM, r2M);
+                int viavel = ns.empty() ? 0 : (int)ns.back();
+                ajuste << fam << ',' << alg << ',' << h << ',' << viavel << ',' << parada << ',' << setprecision(6)
+                       << fT << ',' << r2T << ',' << fE << ',' << r2E << ',' << fM << ',' << r2M << "\n";
+                ajuste.flush();
+                cout << left << setw(12) << fam << setw(5) << alg << setw(3) << h << setw(9) << viavel << setw(9)
+                     << parada << fixed << setprecision(2) << setw(12) << fT << setw(12) << fE << fM << "\n" << flush;
+                cout.unsetf(ios::fixed);
+            }
+        }
+    }
+    cout << "Curvas em " << arquivoCurvas << ", taxas de crescimento em " << arquivoAjuste << "\n";
+    return 0;
+}
+
+// Acumuladores de uma heuristica (somas inteiras exatas, juntadas no fim)
+struct PerfilHeuristica {
+    uint64_t superestimados;
+    uint64_t exatos;
+    int excessoMaximo;
+    uint64_t somaExcesso;
+    double somaRazao; // h/h*, sem os objetivos
+    uint64_t somaH, somaHH, somaHD;
+    vector<uint64_t> somaPorDistancia;
+    vector<uint64_t> expansoes; // por tabuleiro de referencia: g + h < C*
+};
+
+string nomeHeuristica(int h) {
+    if (h == 2) return "fora do lugar";
+    if (h == 3) return "inversoes";
+    return "manhattan";
+}
+
+int perfilarHeuristicas(const map<string, string>& opcoes) {
+    int n = opcoes.count("n") ? atoi(opcoes.at("n").c_str()) : 10;
+    vector<int> heuristicas = lerLista(opcoes.count("heuristicas") ? opcoes.at("heuristicas") : "1,2,3");
+    int threads = opcoes.count("threads") ? atoi(opcoes.at("threads").c_str()) : (int)thread::hardware_concurrency();
+    string arquivo = opcoes.count("saida") ? opcoes.at("saida") : "perfil_heuristicas.csv";
+    if (threads < 1) threads = 1;
+    if (n < 1 || n > GeradorTabuleiros::MAX_FICHAS_DISTANCIAS_EXATAS) {
+        cerr << "--n deve estar entre 1 e " << GeradorTabuleiros::MAX_FICHAS_DISTANCIAS_EXATAS << "\n";
+        return 2;
+    }
+    for (int h : heuristicas) {
+        if (h < 1 || h > 3) {
+            cerr << "Heuristica invalida: " << h << " (use 1, 2 ou 3)\n";
+            return 2;
+        }
+    }
+    ofstream saida(arquivo.c_str(), ios::out | ios::trunc);
+    if (!saida) {
+        cerr << "Nao foi possivel escrever em " << arquivo << "\n";
+        return 2;
+    }
+
+    GeradorTabuleiros gerador(n, 1);
+    const uint64_t total = gerador.totalTabuleiros();
+    chrono::steady_clock::time_point inicio = chrono::steady_clock::now();
+    vector<uint8_t> distancia;
+    gerador.distanciasAoObjetivo(distancia, threads);
+
+    // Distancias a partir dos tabuleiros de referencia (para o g da previsao do A*)
+    vector<string> nomesReferencia;
+    nomesReferencia.push_back("invertido");
+    nomesReferencia.push_back("intercalado");
+    vector<vector<char> > referencias;
+    referencias.push_back(GeradorTabuleiros::invertido(n));
+    referencias.push_back(GeradorTabuleiros::intercalado(n));
+    vector<vector<uint8_t> > desde(referencias.size());
+    vector<int> custoOtimo(referencias.size());
+    for (size_t r = 0; r < referencias.size(); ++r) {
+        if (!gerador.distanciasDe(referencias[r], desde[r], threads)) {
+            cerr << "Distancia acima do limite a partir do tabuleiro " << nomesReferencia[r] << "\n";
+            return 1;
+        }
+        custoOtimo[r] = distancia[gerador.posto(referencias[r])];
+    }
+    double tempoBusca = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+
+    int maxima = 0;
+    for (uint64_t p = 0; p < total; ++p) maxima = max(maxima, (int)distancia[p]);
+    vector<uint64_t> porDistancia(maxima + 1, 0);
+    for (uint64_t p = 0; p < total; ++p) porDistancia[distancia[p]]++;
+
+    // Avaliacao das heuristicas em blocos de postos divididos entre as threads
+    PerfilHeuristica vazio = { 0, 0, 0, 0, 0.0, 0, 0, 0, vector<uint64_t>(maxima + 1, 0),
+                               vector<uint64_t>(referencias.size(), 0) };
+    vector<vector<PerfilHeuristica> > parciais(threads, vector<PerfilHeuristica>(heuristicas.size(), vazio));
+    vector<vector<uint64_t> > cegas(threads, vector<uint64_t>(referencias.size(), 0));
+    const uint64_t BLOCO = 4096;
+    atomic<uint64_t> proximoBloco(0);
+    inicio = chrono::steady_clock::now();
+    auto avaliar = [&](int id) {
+        vector<char> tabuleiro;
+        for (;;) {
+            uint64_t primeiro = proximoBloco.fetch_add(BLOCO);
+            if (primeiro >= total) break;
+            uint64_t ultimo = min(total, primeiro + BLOCO);
+            for (uint64_t p = primeiro; p < ultimo; ++p) {
+                gerador.desposto(p, tabuleiro);
+                int d = distancia[p];
+                for (size_t r = 0; r < referencias.size(); ++r) {
+                    if (desde[r][p] < custoOtimo[r]) cegas[id][r]++;
+                }
+                for (size_t k = 0; k < heuristicas.size(); ++k) {
+                    PerfilHeuristica& a = parciais[id][k];
+                    int h = Solver::heuristica(tabuleiro, heuristicas[k]);
+                    if (h > d) {
+                        a.superestimados++;
+                        a.somaExcesso += h - d;
+                        a.excessoMaximo = max(a.excessoMaximo, h - d);
+                    } else if (h == d) {
+                        a.exatos++;
+                    }
+                    if (d > 0) a.somaRazao += (double)h / d;
+                    a.somaH += h;
+                    a.somaHH += (uint64_t)h * h;
+                    a.somaHD += (uint64_t)h * d;
+                    a.somaPorDistancia[d] += h;
+                    for (size_t r = 0; r < referencias.size(); ++r) {
+                        if (desde[r][p] + h < custoOtimo[r]) a.expansoes[r]++;
+                    }
+                }
+            }
+        }
+    };
+    vector<thread> ajudantes;
+    for (int t = 1; t < threads; ++t) ajudantes.push_back(thread(avaliar, t));
+    avaliar(0);
+    for (thread& t : ajudantes) t.join();
+    double tempoAvaliacao = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+
+    vector<PerfilHeuristica> perfis(heuristicas.size(), vazio);
+    vector<uint64_t> cega(referencias.size(), 0);
+    for (int t = 0; t < threads; ++t) {
+        for (size_t r = 0; r < referencias.size(); ++r) cega[r] += cegas[t][r];
+        for (size_t k = 0; k < heuristicas.size(); ++k) {
+            PerfilHeuristica& a = perfis[k];
+            const PerfilHeuristica& b = parciais[t][k];
+            a.superestimados += b.superestimados;
+            a.exatos += b.exatos;
+            a.excessoMaximo = max(a.excessoMaximo, b.excessoMaximo);
+            a.somaExcesso += b.somaExcesso;
+            a.somaRazao += b.somaRazao;
+            a.somaH += b.somaH;
+            a.somaHH += b.somaHH;
+            a.somaHD += b.somaHD;
+            for (int d = 0; d <= maxima; ++d) a.somaPorDistancia[d] += b.somaPorDistancia[d];
+            for (size_t r = 0; r < referencias.size(); ++r) a.expansoes[r] += b.expansoes[r];
+        }
+    }
+    double somaD = 0.0, somaDD = 0.0;
+    for (int d = 0; d <= maxima; ++d) {
+        somaD += (double)d * porDistancia[d];
+        somaDD += (double)d * d * porDistancia[d];
+    }
+
+    cout << "n = " << n << ": " << total << " tabuleiros, distancia maxima " << maxima << " (" << threads
+         << " threads; buscas em largura " << fixed << setprecision(2) << tempoBusca << " s, avaliacao "
+         << tempoAvaliacao << " s)\n";
+    for (size_t r = 0; r < referencias.size(); ++r) {
+        cout << "  " << nomesReferencia[r] << ": C* = " << custoOtimo[r] << ", busca cega expande " << cega[r]
+             << " tabuleiros\n";
+    }
+    cout << "\n" << left << setw(15) << "heuristica" << setw(9) << "h/h*" << setw(15) << "superestima"
+         << setw(16) << "excesso" << setw(9) << "h = h*" << setw(12) << "correlacao";
+    for (size_t r = 0; r < referencias.size(); ++r) cout << setw(24) << ("A* " + nomesReferencia[r]);
+    cout << "\n";
+    const double N = (double)total;
+    const uint64_t naoObjetivos = total - porDistancia[0];
+    for (size_t k = 0; k < heuristicas.size(); ++k) {
+        const PerfilHeuristica& a = perfis[k];
+        double covariancia = a.somaHD / N - (a.somaH / N) * (somaD / N);
+        double varianciaH = a.somaHH / N - (a.somaH / N) * (a.somaH / N);
+        double varianciaD = somaDD / N - (somaD / N) * (somaD / N);
+        double correlacao = varianciaH > 0.0 && varianciaD > 0.0 ? covariancia / sqrt(varianciaH * varianciaD) : 0.0;
+        stringstream excesso, superestima;
+        superestima << setprecision(1) << fixed << 100.0 * a.superestimados / N << "%";
+        if (a.superestimados > 0) {
+            excesso << "+" << setprecision(1) << fixed << (double)a.somaExcesso / a.superestimados << " (max "
+                    << a.excessoMaximo << ")";
+        } else {
+            excesso << "-";
+        }
+        cout << setw(15) << nomeHeuristica(heuristicas[k]) << setprecision(3) << setw(9)
+             << (naoObjetivos > 0 ? a.somaRazao / naoObjetivos : 0.0) << setw(15) << superestima.str()
+             << setw(16) << excesso.str() << setprecision(1) << setw(9) << (100.0 * a.exatos / N) << setprecision(3)
+             << setw(12) << correlacao;
+        for (size_t r = 0; r < referencias.size(); ++r) {
+            stringstream previsao;
+            previsao << a.expansoes[r] << " (";
+            if (cega[r] > 0) previsao << setprecision(1) << fixed << 100.0 * (1.0 - (double)a.expansoes[r] / cega[r]) << "%)";
+            else previsao << "-)";
+            cout << setw(24) << previsao.str();
+        }
+        cout << "\n";
+    }
+    cout.unsetf(ios::fixed);
+    cout << "\nA*: tabuleiros com g + h < C* (expandidos com qualquer heuristica consistente, fora os empates\n"
+            "em f = C*) e a economia sobre a busca cega; com superestimativas nao vale como previsao\n";
+
+    saida << "distancia,tabuleiros";
+    for (int h : heuristicas) saida << ",h_medio_" << h;
+    saida << "\n";
+    for (int d = 0; d <= maxima; ++d) {
+        saida << d << ',' << porDistancia[d];
+        for (size_t k = 0; k < heuristicas.size(); ++k) {
+            saida << ',' << setprecision(6)
+                  << (porDistancia[d] > 0 ? (double)perfis[k].somaPorDistancia[d] / porDistancia[d] : 0.0);
+        }
+        saida << "\n";
+    }
+    cout << "Media de h por distancia em " << arquivo << "\n";
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    string comando = argc >= 2 ? argv[1] : "";
+    if (comando != "executar" && comando != "comparar" && comando != "varrer" &&
+        comando != "heuristicas") {
+        cerr << "Uso:\n"
+             << "  " << argv[0] << " executar [--historico arq] [--commit id] [--flags texto] [--n 6,8]\n"
+             << "           [--algoritmos 1,4,6] [--heuristica 3] [--conjunto aleatorio:1:10|padrao]\n"
+             << "           [--repeticoes 7] [--rastreio arquivo.json] [--workspace sim|nao]\n"
+             << "  " << argv[0] << " comparar [--historico arq] [--base id] [--atual id] [--limiar 0.05]\n"
+             << "           [--alfa 0.05]\n"
+             << "  " << argv[0] << " varrer [--max-n 12] [--algoritmos 1,...,10] [--heuristicas 1,2,3]\n"
+             << "           [--familias intercalado,invertido,aleatorio] [--amostras 5] [--semente 1]\n"
+             << "           [--tempo 2] [--memoria 512] [--pontos-ajuste 5] [--saida varredura.csv]\n"
+             << "           [--ajuste varredura_ajuste.csv]\n"
+             << "  " << argv[0] << " heuristicas [--n 10] [--heuristicas 1,2,3] [--threads nucleos]\n"
+             << "           [--saida perfil_heuristicas.csv]\n";
+        return 2;
+    }
+    map<string, string> opcoes;
+    for (int i = 2; i + 1 < argc; i += 2) {
+        string nome = argv[i];
+        if (nome.compare(0, 2, "--") != 0) {
+            cerr << "Opcao invalida: " << nome << "\n";
+            return 2;
+        }
+        opcoes[nome.substr(2)] = argv[i + 1];
+    }
+    if (comando == "varrer") return varrer(opcoes);
+    if (comando == "heuristicas") return perfilarHeuristicas(opcoes);
+    return comando == "executar" ? executar(opcoes) : comparar(opcoes);
+}
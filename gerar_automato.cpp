@@ -0,0 +1,297 @@
+// Gera o automato de poda de sequencias de movimentos (AutomatoPoda.h).
+//
+//   gerar_automato [--profundidade 10] [--saida AutomatoPoda.h]
+//
+// O padrao e a profundidade da tabela gravada no repositorio (a mesma de
+// PROFUNDIDADE_AUTOMATO no Makefile), de modo que rodar sem argumentos a
+// refaz igual.
+//
+// Os movimentos sao vistos a partir do vazio (operadores 0 a 3: deslizar
+// para a esquerda e para a direita, pular para a esquerda e para a direita).
+// Todas as sequencias de ate 'profundidade' operadores sao aplicadas numa
+// regua sem bordas com fichas todas distintas. Uma sequencia e redundante se
+// uma sequencia anterior (mais curta, ou do mesmo tamanho e menor na ordem
+// lexicografica) deixa as fichas na mesma posicao e leva o vazio so por casas
+// que ela tambem visita: onde a sequencia cabe na regua, a anterior tambem
+// cabe e chega ao mesmo tabuleiro, qualquer que seja a cor das fichas.
+//
+// As sequencias redundantes minimas (sem trecho redundante menor) viram um
+// automato de Aho-Corasick que e minimizado e gravado como tabela. Seguindo
+// o automato, uma busca em profundidade descarta um filho com uma consulta
+// a tabela, sem calcular hash do tabuleiro. O menor caminho na ordem acima
+// entre os caminhos otimos nunca e podado.
+
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <string>
+#include <map>
+#include <set>
+#include <queue>
+#include <algorithm>
+#include <cstdlib>
+
+using namespace std;
+
+const int DESLOCAMENTO[4] = { -1, +1, -2, +2 };
+const char* const NOME_OPERADOR[4] = { "deslizar esq", "deslizar dir", "pular esq", "pular dir" };
+
+struct Sequencia {
+    string operadores;   // um caractere '0'..'3' por movimento
+    vector<int> regua;   // ficha em cada casa; 0 = vazio
+    int vazio;           // casa do vazio, relativa a janela
+    int minimo, maximo;  // casas visitadas pelo vazio
+};
+
+struct Visita {
+    int minimo, maximo;
+};
+
+struct Automato {
+    vector<vector<int> > transicoes; // -1 = sequencia podada
+};
+
+// Sequencias redundantes minimas, por tamanho e ordem lexicografica
+vector<string> enumerarRedundantes(int profundidade, long long& sequenciasValidas) {
+    int largura = 4 * profundidade + 1;
+    Sequencia vazia;
+    vazia.regua.resize(largura);
+    for (int i = 0; i < largura; ++i) vazia.regua[i] = i + 1;
+    vazia.vazio = 2 * profundidade;
+    vazia.regua[vazia.vazio] = 0;
+    vazia.minimo = vazia.maximo = vazia.vazio;
+
+    map<vector<int>, vector<Visita> > vistas;
+    Visita v0 = { vazia.vazio, vazia.vazio };
+    vistas[vazia.regua].push_back(v0);
+
+    set<string> redundantes;
+    vector<string> ordem;
+    vector<Sequencia> camada(1, vazia);
+    sequenciasValidas = 1;
+    for (int tamanho = 1; tamanho <= profundidade; ++tamanho) {
+        vector<Sequencia> proxima;
+        for (const Sequencia& s : camada) {
+            for (int op = 0; op < 4; ++op) {
+                Sequencia n = s;
+                n.operadores += (char)('0' + op);
+                // Um sufixo ja redundante torna a sequencia inteira redundante
+                bool contem = false;
+                for (size_t i = 1; i < n.operadores.size() && !contem; ++i) {
+                    contem = redundantes.count(n.operadores.substr(i)) > 0;
+                }
+                if (contem) continue;
+                int destino = n.vazio + DESLOCAMENTO[op];
+                swap(n.regua[n.vazio], n.regua[destino]);
+                n.vazio = destino;
+                n.minimo = min(n.minimo, destino);
+                n.maximo = max(n.maximo, destino);
+
+                vector<Visita>& anteriores = vistas[n.regua];
+                bool redundante = false;
+                for (const Visita& a : anteriores) {
+                    if (a.minimo >= n.minimo && a.maximo <= n.maximo) {
+                        redundante = true;
+                        break;
+                    }
+                }
+                if (redundante) {
+                    redundantes.insert(n.operadores);
+                    ordem.push_back(n.operadores);
+                    continue;
+                }
+                Visita v = { n.minimo, n.maximo };
+                anteriores.push_back(v);
+                proxima.push_back(n);
+            }
+        }
+        sequenciasValidas += (long long)proxima.size();
+        camada.swap(proxima);
+    }
+    return ordem;
+}
+
+// Aho-Corasick sobre as sequencias redundantes; estados que reconhecem uma
+// delas sao removidos (transicao -1)
+Automato construirAutomato(const vector<string>& redundantes) {
+    vector<vector<int> > trie(1, vector<int>(4, -1));
+    vector<bool> final(1, false);
+    for (const string& s : redundantes) {
+        int e = 0;
+        for (char c : s) {
+            int op = c - '0';
+            if (trie[e][op] < 0) {
+                trie[e][op] = (int)trie.size();
+                trie.push_back(vector<int>(4, -1));
+                final.push_back(false);
+            }
+            e = trie[e][op];
+        }
+        final[e] = true;
+    }
+
+    vector<int> falha(trie.size(), 0);
+    vector<vector<int> > delta = trie;
+    queue<int> fila;
+    for (int op = 0; op < 4; ++op) {
+        if (delta[0][op] < 0) {
+            delta[0][op] = 0;
+        } else {
+            falha[delta[0][op]] = 0;
+            fila.push(delta[0][op]);
+        }
+    }
+    while (!fila.empty()) {
+        int e = fila.front();
+        fila.pop();
+        if (final[falha[e]]) final[e] = true;
+        for (int op = 0; op < 4; ++op) {
+            int f = trie[e][op];
+            if (f < 0) {
+                delta[e][op] = delta[falha[e]][op];
+            } else {
+                falha[f] = delta[falha[e]][op];
+                fila.push(f);
+            }
+        }
+    }
+
+    Automato a;
+    a.transicoes.assign(trie.size(), vector<int>(4, -1));
+    for (size_t e = 0; e < trie.size(); ++e) {
+        for (int op = 0; op < 4; ++op) {
+            int f = delta[e][op];
+            a.transicoes[e][op] = final[f] ? -1 : f;
+        }
+    }
+    return a;
+}
+
+// Minimizacao de Moore (refinamento de particoes) e renumeracao em largura a
+// partir do estado inicial, descartando estados inalcancaveis
+Automato minimizar(const Automato& a) {
+    size_t n = a.transicoes.size();
+    vector<int> classe(n, 0);
+    int numClasses = 1;
+    while (true) {
+        map<vector<int>, int> assinaturas;
+        vector<int> nova(n);
+        for (size_t e = 0; e < n; ++e) {
+            vector<int> assinatura(1, classe[e]);
+            for (int op = 0; op < 4; ++op) {
+                int f = a.transicoes[e][op];
+                assinatura.push_back(f < 0 ? -1 : classe[f]);
+            }
+            auto it = assinaturas.insert(make_pair(assinatura, (int)assinaturas.size())).first;
+            nova[e] = it->second;
+        }
+        int total = (int)assinaturas.size();
+        classe.swap(nova);
+        if (total == numClasses) break;
+        numClasses = total;
+    }
+
+    vector<int> representante(numClasses, -1);
+    for (size_t e = 0; e < n; ++e) {
+        if (representante[classe[e]] < 0) representante[classe[e]] = (int)e;
+    }
+    vector<int> numero(numClasses, -1);
+    vector<int> ordem;
+    numero[classe[0]] = 0;
+    ordem.push_back(classe[0]);
+    for (size_t i = 0; i < ordem.size(); ++i) {
+        int e = representante[ordem[i]];
+        for (int op = 0; op < 4; ++op) {
+            int f = a.transicoes[e][op];
+            if (f >= 0 && numero[classe[f]] < 0) {
+                numero[classe[f]] = (int)ordem.size();
+                ordem.push_back(classe[f]);
+            }
+        }
+    }
+
+    Automato m;
+    m.transicoes.assign(ordem.size(), vector<int>(4, -1));
+    for (size_t i = 0; i < ordem.size(); ++i) {
+        int e = representante[ordem[i]];
+        for (int op = 0; op < 4; ++op) {
+            int f = a.transicoes[e][op];
+            m.transicoes[i][op] = f < 0 ? -1 : numero[classe[f]];
+        }
+    }
+    return m;
+}
+
+bool gravarCabecalho(const string& arquivo, const Automato& a, int profundidade,
+                     size_t numRedundantes, const vector<string>& exemplos) {
+    ofstream out(arquivo.c_str());
+    if (!out) return false;
+    out << "#ifndef AUTOMATO_PODA_H\n"
+        << "#define AUTOMATO_PODA_H\n\n"
+        << "// Gerado por gerar_automato (make automato). Nao editar.\n"
+        << "//\n"
+        << "// Automato que reconhece as " << numRedundantes << " sequencias redundantes minimas de ate "
+        << profundidade << "\n"
+        << "// movimentos. Operadores (destino do vazio): 0 = v - 1, 1 = v + 1, 2 = v - 2,\n"
+        << "// 3 = v + 2. Uma transicao -1 poda o movimento. Exemplos:\n";
+    for (const string& s : exemplos) {
+        out << "//   ";
+        for (size_t i = 0; i < s.size(); ++i) out << (i ? ", " : "") << NOME_OPERADOR[s[i] - '0'];
+        out << "\n";
+    }
+    out << "\nnamespace AutomatoPoda {\n\n"
+        << "const int PROFUNDIDADE = " << profundidade << ";\n"
+        << "const int NUM_ESTADOS = " << a.transicoes.size() << ";\n"
+        << "const int INICIAL = 0;\n"
+        << "const int PODADO = -1;\n\n"
+        << "const short TRANSICOES[NUM_ESTADOS][4] = {\n";
+    for (size_t e = 0; e < a.transicoes.size(); ++e) {
+        out << "    { ";
+        for (int op = 0; op < 4; ++op) out << (op ? ", " : "") << a.transicoes[e][op];
+        out << " },\n";
+    }
+    out << "};\n\n"
+        << "// Operador do movimento que leva o vazio de 'vazio' para 'destino'\n"
+        << "inline int operador(int vazio, int destino) {\n"
+        << "    int d = destino - vazio;\n"
+        << "    return d == -1 ? 0 : d == 1 ? 1 : d == -2 ? 2 : 3;\n"
+        << "}\n\n"
+        << "inline int proximo(int estado, int vazio, int destino) {\n"
+        << "    return TRANSICOES[estado][operador(vazio, destino)];\n"
+        << "}\n\n"
+        << "} // namespace AutomatoPoda\n\n"
+        << "#endif\n";
+    return (bool)out;
+}
+
+int main(int argc, char** argv) {
+    int profundidade = 10;
+    string saida = "AutomatoPoda.h";
+    for (int i = 1; i < argc; i += 2) {
+        string nome = argv[i];
+        if (i + 1 >= argc || (nome != "--profundidade" && nome != "--saida")) {
+            cerr << "Uso: " << argv[0] << " [--profundidade 10] [--saida AutomatoPoda.h]\n";
+            return 2;
+        }
+        if (nome == "--profundidade") profundidade = atoi(argv[i + 1]);
+        else saida = argv[i + 1];
+    }
+    if (profundidade < 1 || profundidade > 16) {
+        cerr << "Profundidade deve estar entre 1 e 16\n";
+        return 2;
+    }
+
+    long long validas = 0;
+    vector<string> redundantes = enumerarRedundantes(profundidade, validas);
+    Automato automato = minimizar(construirAutomato(redundantes));
+    vector<string> exemplos(redundantes.begin(), redundantes.begin() + min<size_t>(4, redundantes.size()));
+    if (!gravarCabecalho(saida, automato, profundidade, redundantes.size(), exemplos)) {
+        cerr << "Nao foi possivel gravar " << saida << "\n";
+        return 1;
+    }
+    cout << "Sequencias validas ate " << profundidade << " movimentos: " << validas << "\n"
+         << "Sequencias redundantes minimas: " << redundantes.size() << "\n"
+         << "Estados do automato: " << automato.transicoes.size() << "\n"
+         << "Gravado em " << saida << "\n";
+    return 0;
+}
@@ -7,7 +7,12 @@
 #include <ctime>
 #include "ReguaPuzzle.h"
 #include "Solver.h"
+#include "Gerador.h"
+#include "Rastreio.h"
+#include <chrono>
 #include <iomanip> // Para setw e fixed
+#include <thread>
+#include <atomic>
 
 using namespace std;
 
@@ -19,6 +24,7 @@ void mostrarMenu()
     cout << "3. Solucionador automatico\n";
     cout << "4. Sair\n";
     cout << "5. Comparar algoritmos\n"; // Nova opção
+    cout << "6. Gerar instancias\n";
     cout << "Escolha uma opcao: ";
 }
 
@@ -70,6 +76,9 @@ void mostrarMenuAlgoritmos()
     cout << "5. Busca Gulosa\n";
     cout << "6. Busca A*\n";
     cout << "7. Busca IDA*\n";
+    cout << "8. Busca A* Anytime (ARA*)\n";
+    cout << "9. Busca em Feixe\n";
+    cout << "10. Construtivo (sem busca)\n";
     cout << "Digite a opcao: ";
 }
 
@@ -78,6 +87,7 @@ void mostrarMenuHeuristicas()
     cout << "\nEscolha a heuristica:\n";
     cout << "1. Manhattan\n";
     cout << "2. Fichas Fora do Lugar\n";
+    cout << "3. Inversoes (admissivel)\n";
     cout << "Digite a opcao: ";
 }
 
@@ -99,15 +109,21 @@ string obterNomeAlgoritmo(int algoritmo)
         return "Busca A*";
     case 7:
         return "Busca IDA*";
+    case 8:
+        return "Busca A* Anytime (ARA*)";
+    case 9:
+        return "Busca em Feixe";
+    case 10:
+        return "Construtivo (sem busca)";
     default:
         return "Desconhecido";
     }
 }
 
 void mostrarTabelaComparacao(const vector<SolverStats>& statsList, const vector<string>& nomes) {
-    cout << "\n+-----------------------------------+------------------------+---------------------------+--------------------+------------------+---------------------------+----------------------------+" << endl;
-    cout << "| Algoritmo                         | Tamanho do Caminho     | Profundidade da Solucao  | Nos Expandidos     | Nos Visitados    | Tempo de Execucao (s)     | Fator de Ramificacao       |" << endl;
-    cout << "+-----------------------------------+------------------------+---------------------------+--------------------+------------------+---------------------------+----------------------------+" << endl;
+    cout << "\n+-----------------------------------+------------------------+---------------------------+--------------------+------------------+--------------------+--------------------+----------------------------+" << endl;
+    cout << "| Algoritmo                         | Tamanho do Caminho     | Profundidade da Solucao  | Nos Expandidos     | Nos Visitados    | Tempo Real (s)     | Tempo de CPU (s)   | Fator de Ramificacao       |" << endl;
+    cout << "+-----------------------------------+------------------------+---------------------------+--------------------+------------------+--------------------+--------------------+----------------------------+" << endl;
 
     for (size_t i = 0; i < statsList.size(); ++i) {
         const SolverStats& s = statsList[i];
@@ -118,19 +134,51 @@ void mostrarTabelaComparacao(const vector<SolverStats>& statsList, const vector<
                  << "| " << setw(27) << "N/A"
                  << "| " << setw(20) << s.nos_expandidos
                  << "| " << setw(18) << s.nos_visitados
-                 << "| " << setw(27) << fixed << setprecision(4) << s.tempo_execucao
+                 << "| " << setw(20) << fixed << setprecision(4) << s.tempo_execucao
+                 << "| " << setw(20) << fixed << setprecision(4) << s.tempo_cpu
                  << "| " << setw(28) << "N/A" << "|" << endl;
         } else {
             cout << "| " << left << setw(23) << s.caminho.size()
                  << "| " << setw(27) << s.profundidade
                  << "| " << setw(20) << s.nos_expandidos
                  << "| " << setw(18) << s.nos_visitados
-                 << "| " << setw(27) << fixed << setprecision(4) << s.tempo_execucao
+                 << "| " << setw(20) << fixed << setprecision(4) << s.tempo_execucao
+                 << "| " << setw(20) << fixed << setprecision(4) << s.tempo_cpu
                  << "| " << setw(28) << fixed << setprecision(2) << s.fator_ramificacao << "|" << endl;
         }
     }
 
-    cout << "+-----------------------------------+------------------------+---------------------------+--------------------+------------------+---------------------------+----------------------------+\n";
+    cout << "+-----------------------------------+------------------------+---------------------------+--------------------+------------------+--------------------+--------------------+----------------------------+\n";
+}
+
+// Resolve o mesmo tabuleiro com varios algoritmos ao mesmo tempo, em ate um
+// thread por nucleo. Os que podem estourar o timeout (Backtracking, DFS e
+// IDA*) saem primeiro da fila para nao ficarem para o fim. Com mais tarefas
+// que nucleos o tempo real de cada uma cresce; o de CPU (por thread) nao.
+vector<SolverStats> resolverEmParalelo(const vector<char>& tabuleiro, const vector<int>& algoritmos, int heuristica) {
+    vector<size_t> ordem;
+    for (size_t i = 0; i < algoritmos.size(); ++i) {
+        if (algoritmos[i] == 2 || algoritmos[i] == 3 || algoritmos[i] == 7) ordem.push_back(i);
+    }
+    for (size_t i = 0; i < algoritmos.size(); ++i) {
+        if (find(ordem.begin(), ordem.end(), i) == ordem.end()) ordem.push_back(i);
+    }
+
+    vector<SolverStats> resultados(algoritmos.size());
+    atomic<size_t> proxima(0);
+    unsigned numThreads = thread::hardware_concurrency();
+    numThreads = max(1u, min(numThreads, (unsigned)algoritmos.size()));
+    vector<thread> threads;
+    for (unsigned t = 0; t < numThreads; ++t) {
+        threads.push_back(thread([&]() {
+            for (size_t k = proxima++; k < ordem.size(); k = proxima++) {
+                size_t i = ordem[k];
+                resultados[i] = Solver::resolver(tabuleiro, algoritmos[i], heuristica);
+            }
+        }));
+    }
+    for (size_t t = 0; t < threads.size(); ++t) threads[t].join();
+    return resultados;
 }
 
 
@@ -142,6 +190,131 @@ bool desejaTabuleiroAleatorio() {
     return (resp == 's' || resp == 'S');
 }
 
+int pedirLarguraFeixe()
+{
+    int largura;
+    cout << "\nDigite a largura do feixe (estados por camada, minimo 1): ";
+    while (true)
+    {
+        cin >> largura;
+        if (cin.fail() || largura < 1)
+        {
+            cout << "Valor invalido. Digite um numero maior ou igual a 1: ";
+            cin.clear();
+            cin.ignore(numeric_limits<streamsize>::max(), '\n');
+        }
+        else
+        {
+            break;
+        }
+    }
+    return largura;
+}
+
+int pedirRaioPerimetro()
+{
+    int raio;
+    cout << "Raio do perimetro de distancias exatas em volta dos objetivos (0 = desligado, ex.: 24): ";
+    while (true)
+    {
+        cin >> raio;
+        if (cin.fail() || raio < 0)
+        {
+            cout << "Valor invalido. Digite um numero maior ou igual a 0: ";
+            cin.clear();
+            cin.ignore(numeric_limits<streamsize>::max(), '\n');
+        }
+        else
+        {
+            break;
+        }
+    }
+    return raio;
+}
+
+int pedirCusto(const char* descricao)
+{
+    int custo;
+    cout << "Custo de " << descricao << " (minimo 0): ";
+    while (true)
+    {
+        cin >> custo;
+        if (cin.fail() || custo < 0)
+        {
+            cout << "Valor invalido. Digite um numero maior ou igual a 0: ";
+            cin.clear();
+            cin.ignore(numeric_limits<streamsize>::max(), '\n');
+        }
+        else
+        {
+            break;
+        }
+    }
+    return custo;
+}
+
+ModeloCusto pedirModeloCusto()
+{
+    ModeloCusto custos;
+    char resp;
+    cout << "\nDeseja definir o custo dos movimentos? (s/n): ";
+    cin >> resp;
+    if (resp == 's' || resp == 'S')
+    {
+        custos.deslizar = pedirCusto("deslizar uma ficha");
+        custos.pulo = pedirCusto("pular uma ficha");
+    }
+    return custos;
+}
+
+bool desejaOtimizarCaminho() {
+    char resp;
+    cout << "\nDeseja otimizar o caminho encontrado? (s/n): ";
+    cin >> resp;
+    return (resp == 's' || resp == 'S');
+}
+
+PoliticaDesempate pedirDesempate()
+{
+    int p;
+    cout << "\nDesempate entre estados com a mesma prioridade:\n";
+    cout << "0. Qualquer (ordem da fila)\n";
+    cout << "1. Maior g (mais fundo primeiro)\n";
+    cout << "2. Menor h\n";
+    cout << "3. LIFO (ultimo inserido primeiro)\n";
+    cout << "4. Aleatorio com semente\n";
+    cout << "Digite a opcao: ";
+    while (true)
+    {
+        cin >> p;
+        if (cin.fail() || p < 0 || p > 4)
+        {
+            cout << "Opcao invalida. Digite de 0 a 4: ";
+            cin.clear();
+            cin.ignore(numeric_limits<streamsize>::max(), '\n');
+        }
+        else
+        {
+            break;
+        }
+    }
+    return static_cast<PoliticaDesempate>(p);
+}
+
+bool desejaHistograma() {
+    char resp;
+    cout << "Registrar histograma por camada (nos expandidos, gerados e duplicados)? (s/n): ";
+    cin >> resp;
+    return (resp == 's' || resp == 'S');
+}
+
+bool desejaBuscaFronteira() {
+    char resp;
+    cout << "Usar busca de fronteira (sem lista de fechados, menos memoria)? (s/n): ";
+    cin >> resp;
+    return (resp == 's' || resp == 'S');
+}
+
 int pedirHeuristica()
 {
     int h;
@@ -149,9 +322,9 @@ int pedirHeuristica()
     while (true)
     {
         cin >> h;
-        if (cin.fail() || h < 1 || h > 2)
+        if (cin.fail() || h < 1 || h > 3)
         {
-            cout << "Opcao invalida. Digite 1 ou 2: ";
+            cout << "Opcao invalida. Digite 1, 2 ou 3: ";
             cin.clear();
             cin.ignore(numeric_limits<streamsize>::max(), '\n');
         }
@@ -163,31 +336,110 @@ int pedirHeuristica()
     return h;
 }
 
-
-vector<char> gerarTabuleiroPadrao(int num_fichas)
+NivelDetalhe pedirNivelDetalhe()
 {
-    vector<char> tabuleiro;
-    int tamanho = 2 * num_fichas + 1;
-
-    char atual = 'A';
-
-    for (int i = 0; i < tamanho; ++i)
+    int nivel;
+    cout << "\nEscolha o nivel de detalhe da solucao:\n";
+    cout << "1. Resumo (apenas estatisticas)\n";
+    cout << "2. Compacto (uma linha por movimento)\n";
+    cout << "3. Completo (tabuleiro a cada movimento)\n";
+    cout << "Digite a opcao: ";
+    while (true)
     {
-        if (i == num_fichas)
+        cin >> nivel;
+        if (cin.fail() || nivel < 1 || nivel > 3)
         {
-            tabuleiro.push_back('_');
+            cout << "Opcao invalida. Digite 1, 2 ou 3: ";
+            cin.clear();
+            cin.ignore(numeric_limits<streamsize>::max(), '\n');
         }
         else
         {
-            tabuleiro.push_back(atual);
-            atual = (atual == 'A') ? 'B' : 'A'; // alterna entre A e B
+            break;
         }
     }
+    return static_cast<NivelDetalhe>(nivel);
+}
 
-    return tabuleiro;
+string pedirArquivoSaida()
+{
+    char resp;
+    cout << "\nDeseja salvar a solucao em arquivo? (s/n): ";
+    cin >> resp;
+    if (resp != 's' && resp != 'S')
+        return "";
+    string arquivo;
+    cout << "Nome do arquivo: ";
+    cin >> arquivo;
+    return arquivo;
 }
 
+vector<char> gerarTabuleiroPadrao(int num_fichas)
+{
+    return GeradorTabuleiros::intercalado(num_fichas);
+}
+
+
 
+void gerarInstancias()
+{
+    cout << "\n=== GERAR INSTANCIAS ===\n";
+    int n = pedirNumFichas();
+    long long quantidade;
+    cout << "Quantidade de instancias: ";
+    while (!(cin >> quantidade) || quantidade < 1)
+    {
+        cout << "Valor invalido. Digite um numero maior ou igual a 1: ";
+        cin.clear();
+        cin.ignore(numeric_limits<streamsize>::max(), '\n');
+    }
+    unsigned long long semente;
+    cout << "Semente: ";
+    while (!(cin >> semente))
+    {
+        cout << "Valor invalido. Digite um numero inteiro nao negativo: ";
+        cin.clear();
+        cin.ignore(numeric_limits<streamsize>::max(), '\n');
+    }
+    int formato;
+    cout << "Formato (1 = texto, 2 = binario): ";
+    while (!(cin >> formato) || formato < 1 || formato > 2)
+    {
+        cout << "Opcao invalida. Digite 1 ou 2: ";
+        cin.clear();
+        cin.ignore(numeric_limits<streamsize>::max(), '\n');
+    }
+    bool estratificado = false;
+    if (n <= GeradorTabuleiros::MAX_FICHAS_DISTANCIAS)
+    {
+        char resp;
+        cout << "Estratificar pela distancia ate o objetivo? (s/n): ";
+        cin >> resp;
+        estratificado = (resp == 's' || resp == 'S');
+    }
+    string arquivo;
+    cout << "Nome do arquivo: ";
+    cin >> arquivo;
+
+    GeradorTabuleiros gerador(n, semente);
+    auto inicio = chrono::high_resolution_clock::now();
+    long long gravadas = gerador.gravarLote(arquivo, quantidade, static_cast<GeradorTabuleiros::FormatoLote>(formato),
+                                            estratificado);
+    double segundos = chrono::duration<double>(chrono::high_resolution_clock::now() - inicio).count();
+    if (gravadas < 0)
+    {
+        cout << "Nao foi possivel escrever em " << arquivo << "\n";
+        return;
+    }
+    cout << gravadas << " instancias gravadas em " << arquivo << " (" << fixed << setprecision(2) << segundos << " s";
+    if (segundos > 0)
+        cout << ", " << setprecision(0) << gravadas / segundos << " por segundo";
+    cout << ")\n";
+    cout.unsetf(ios::fixed);
+    cout << setprecision(6);
+    if (estratificado)
+        cout << "Distancias de 0 a " << gerador.distanciaMaxima() << " em rodizio\n";
+}
 
 int escolherTipoTabuleiro()
 {
@@ -216,6 +468,9 @@ int escolherTipoTabuleiro()
 int main()
 {
     srand(time(0));
+    // REGUA_RASTREIO=arquivo.json grava o rastreio das buscas ao sair (Perfetto)
+    const char* arquivoRastreio = getenv("REGUA_RASTREIO");
+    if (arquivoRastreio && *arquivoRastreio) Rastreio::ativar(true);
     int num_fichas = 3;
     ReguaPuzzle jogo(num_fichas);
     int opcao;
@@ -284,15 +539,65 @@ int main()
             cin >> alg;
 
                 int heuristica = 1;
-                if (alg == 5 || alg == 6 || alg == 7) {
+                if (alg == 5 || alg == 6 || alg == 7 || alg == 8 || alg == 9) {
                     heuristica = pedirHeuristica();
                 }
                 
-                if (alg >= 1 && alg <= 7) {
+                if (alg >= 1 && alg <= 10) {
                     string nomeAlg = obterNomeAlgoritmo(alg);
                     cout << "\nProcurando solucao (" << nomeAlg << ")...\n";
-                    SolverStats stats = Solver::resolver(tabuleiro, alg, heuristica);
-                    Solver::mostrarSolucao(tabuleiro, stats);
+                    OpcoesSolver opcoes;
+                    if (alg != 10) {
+                        opcoes.histograma = desejaHistograma();
+                    }
+                    if (alg == 1 || alg == 6) {
+                        opcoes.fronteira = desejaBuscaFronteira();
+                    }
+                    if (alg == 4 || alg == 6) {
+                        opcoes.custos = pedirModeloCusto();
+                        if (alg == 6 && opcoes.fronteira && opcoes.custos.custoMinimo() == 0) {
+                            cout << "Ha movimento de custo 0: usando o A* com lista de fechados.\n";
+                            opcoes.fronteira = false;
+                        }
+                    }
+                    if ((alg == 6 && !opcoes.fronteira) || alg == 7) {
+                        opcoes.raio_perimetro = pedirRaioPerimetro();
+                    }
+                    if (alg == 5 || alg == 6) {
+                        opcoes.desempate = pedirDesempate();
+                        if (opcoes.desempate == DESEMPATE_ALEATORIO) {
+                            cout << "Semente: ";
+                            cin >> opcoes.semente_desempate;
+                        }
+                    }
+                    if (alg == 9) {
+                        opcoes.largura_feixe = pedirLarguraFeixe();
+                        opcoes.feixe_paralelo = true;
+                    }
+                    if (alg == 8) {
+                        opcoes.aoMelhorarSolucao = [](const SolverStats& s) {
+                            cout << "  Solucao com " << s.caminho.size() << " movimentos (limite de subotimalidade "
+                                 << fixed << setprecision(3) << s.limite_subotimalidade << ") em "
+                                 << setprecision(4) << s.tempo_execucao << " s\n";
+                            cout.unsetf(ios::fixed);
+                            cout << setprecision(6);
+                        };
+                    }
+                    SolverStats stats = Solver::resolver(tabuleiro, alg, heuristica, opcoes);
+                    if ((alg == 2 || alg == 3 || alg == 5 || alg == 9 || alg == 10) && !stats.caminho.empty() && desejaOtimizarCaminho()) {
+                        size_t tamanhoOriginal = stats.caminho.size();
+                        Solver::otimizarCaminho(tabuleiro, stats);
+                        cout << "Caminho otimizado: " << tamanhoOriginal << " -> " << stats.caminho.size() << " movimentos\n";
+                    }
+                    NivelDetalhe nivel = pedirNivelDetalhe();
+                    string arquivo = pedirArquivoSaida();
+                    if (arquivo.empty()) {
+                        Solver::mostrarSolucao(tabuleiro, stats, nivel, cout);
+                    } else if (Solver::salvarSolucao(tabuleiro, stats, nivel, arquivo)) {
+                        cout << "Solucao salva em " << arquivo << "\n";
+                    } else {
+                        cout << "Nao foi possivel escrever em " << arquivo << "\n";
+                    }
                 } else {
                     cout << "Opcao invalida!\n";
                 }
@@ -307,29 +612,38 @@ int main()
             case 5: {
                 cout << "\n=== COMPARAR ALGORITMOS ===\n";
                 num_fichas = pedirNumFichas();
-                vector<char> tabuleiro;
-                for (int i = 0; i < num_fichas; ++i) tabuleiro.push_back('A');
-                tabuleiro.push_back('_');
-                for (int i = 0; i < num_fichas; ++i) tabuleiro.push_back('B');
+                vector<char> tabuleiro = GeradorTabuleiros::invertido(num_fichas);
                 int heuristica = 1;
-                cout << "\nPara algoritmos heuristicos (Gulosa, A*, IDA*):";
+                cout << "\nPara algoritmos heuristicos (Gulosa, A*, IDA*, ARA*, Feixe):";
                 heuristica = pedirHeuristica();
-                vector<SolverStats> statsList;
+                vector<int> algoritmos;
                 vector<string> nomes;
-                for (int alg = 1; alg <= 7; ++alg) {
+                for (int alg = 1; alg <= 10; ++alg) {
+                    algoritmos.push_back(alg);
                     nomes.push_back(obterNomeAlgoritmo(alg));
-                    statsList.push_back(Solver::resolver(tabuleiro, alg, heuristica));
                 }
+                auto inicio = chrono::steady_clock::now();
+                vector<SolverStats> statsList = resolverEmParalelo(tabuleiro, algoritmos, heuristica);
+                double total = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
                 mostrarTabelaComparacao(statsList, nomes);
+                cout << "Comparacao concluida em " << fixed << setprecision(2) << total << " s\n";
+                cout.unsetf(ios::fixed);
                 cout << "\nPressione Enter para continuar...\n";
                 cin.ignore(numeric_limits<streamsize>::max(), '\n');
                 cin.get();
                 break;
             }
+            case 6:
+                gerarInstancias();
+                break;
             default:
                 cout << "Opcao invalida!\n";
         }
     } while (opcao != 4);
 
+    if (arquivoRastreio && *arquivoRastreio) {
+        if (Rastreio::gravar(arquivoRastreio)) cout << "Rastreio gravado em " << arquivoRastreio << "\n";
+        else cout << "Nao foi possivel escrever em " << arquivoRastreio << "\n";
+    }
     return 0;
 }
\ No newline at end of file
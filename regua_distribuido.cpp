@@ -0,0 +1,118 @@
+// Busca em largura e A* distribuidas entre processos (ver Distribuido.h).
+//
+//   regua_distribuido [--tabuleiro AAA_BBB | --n 8] [--algoritmo 6] [--heuristica 3]
+//                     [--trabalhadores 4] [--transporte unix|tcp] [--porta 47000]
+//                     [--lote 4096] [--detalhe 1]
+//       cria os trabalhadores nesta maquina (fork) e resolve
+//
+//   regua_distribuido trabalhador --id i --enderecos e0,e1,...
+//   regua_distribuido coordenar --enderecos e0,e1,... [--tabuleiro ...] [--algoritmo ...]
+//       trabalhadores iniciados a parte, por exemplo um por maquina com
+//       enderecos "tcp:host:porta"; o coordenador espera --espera segundos
+//       por cada um
+//
+// Sem --tabuleiro resolve o invertido (AAA_BBB) com --n fichas de cada cor.
+
+#include "Distribuido.h"
+#include "Gerador.h"
+#include "Caminho.h"
+#include <iostream>
+#include <sstream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <map>
+#include <cstdlib>
+
+using namespace std;
+
+vector<string> lerEnderecos(const string& texto) {
+    vector<string> enderecos;
+    stringstream lista(texto);
+    string endereco;
+    while (getline(lista, endereco, ',')) {
+        if (!endereco.empty()) enderecos.push_back(endereco);
+    }
+    return enderecos;
+}
+
+void exibir(const vector<char>& inicial, const ResultadoDistribuido& resultado, int detalhe) {
+    if (!resultado.erro.empty()) {
+        cerr << "Erro: " << resultado.erro << "\n";
+        return;
+    }
+    if (resultado.stats.profundidade < 0) {
+        cout << "Nenhuma solucao encontrada.\n";
+    } else if (resultado.stats.profundidade == 0) {
+        cout << "O tabuleiro ja esta resolvido (0 movimentos).\n";
+    } else {
+        RenderizadorSolucao renderizador(cout, (NivelDetalhe)detalhe);
+        renderizador.renderizar(inicial, resultado.stats.caminho, resultado.stats);
+    }
+    cout << "Rodadas (limites de f): " << resultado.rodadas << ", passos: " << resultado.passos << "\n"
+         << "Lotes trocados: " << resultado.mensagens << " (" << fixed << setprecision(1)
+         << resultado.bytes_enviados / (1024.0 * 1024.0) << " MB)\n";
+    for (size_t i = 0; i < resultado.estados_por_trabalhador.size(); ++i) {
+        cout << "  trabalhador " << i << ": " << resultado.estados_por_trabalhador[i] << " estados, "
+             << resultado.bytes_por_trabalhador[i] / (1024.0 * 1024.0) << " MB\n";
+    }
+    cout.unsetf(ios::fixed);
+}
+
+int main(int argc, char** argv) {
+    string comando = (argc >= 2 && string(argv[1]).compare(0, 2, "--") != 0) ? argv[1] : "resolver";
+    int primeira = comando == "resolver" ? 1 : 2;
+    map<string, string> opcoes;
+    for (int i = primeira; i + 1 < argc; i += 2) {
+        string nome = argv[i];
+        if (nome.compare(0, 2, "--") != 0) {
+            cerr << "Opcao invalida: " << nome << "\n";
+            return 2;
+        }
+        opcoes[nome.substr(2)] = argv[i + 1];
+    }
+    if ((comando != "resolver" && comando != "trabalhador" && comando != "coordenar") ||
+        (comando != "resolver" && !opcoes.count("enderecos"))) {
+        cerr << "Uso:\n"
+             << "  " << argv[0] << " [--tabuleiro AAA_BBB | --n 8] [--algoritmo 1|6] [--heuristica 3]\n"
+             << "           [--trabalhadores 4] [--transporte unix|tcp] [--porta 47000] [--lote 4096]\n"
+             << "           [--detalhe 1|2|3]\n"
+             << "  " << argv[0] << " trabalhador --id i --enderecos unix:/tmp/t0.sock,tcp:host:porta,...\n"
+             << "  " << argv[0] << " coordenar --enderecos ... [--tabuleiro ...] [--algoritmo ...]\n";
+        return 2;
+    }
+
+    OpcoesDistribuidas distribuidas;
+    if (opcoes.count("trabalhadores")) distribuidas.trabalhadores = atoi(opcoes["trabalhadores"].c_str());
+    if (opcoes.count("transporte")) distribuidas.transporte = opcoes["transporte"];
+    if (opcoes.count("porta")) distribuidas.porta = atoi(opcoes["porta"].c_str());
+    if (opcoes.count("lote")) distribuidas.tamanho_lote = atoi(opcoes["lote"].c_str());
+    if (opcoes.count("espera")) distribuidas.espera_conexao = atof(opcoes["espera"].c_str());
+
+    if (comando == "trabalhador") {
+        int id = opcoes.count("id") ? atoi(opcoes["id"].c_str()) : -1;
+        return BuscaDistribuida::executarTrabalhador(id, lerEnderecos(opcoes["enderecos"]),
+                                                     distribuidas.espera_conexao);
+    }
+
+    int n = opcoes.count("n") ? atoi(opcoes["n"].c_str()) : 8;
+    vector<char> inicial = opcoes.count("tabuleiro") ? vector<char>(opcoes["tabuleiro"].begin(),
+                                                                    opcoes["tabuleiro"].end())
+                                                     : GeradorTabuleiros::invertido(n);
+    int algoritmo = opcoes.count("algoritmo") ? atoi(opcoes["algoritmo"].c_str()) : 6;
+    int heuristica = opcoes.count("heuristica") ? atoi(opcoes["heuristica"].c_str()) : 3;
+    int detalhe = opcoes.count("detalhe") ? atoi(opcoes["detalhe"].c_str()) : DETALHE_RESUMO;
+    if (detalhe < DETALHE_RESUMO || detalhe > DETALHE_COMPLETO) detalhe = DETALHE_RESUMO;
+    if (distribuidas.trabalhadores < 1) {
+        cerr << "--trabalhadores deve ser pelo menos 1\n";
+        return 2;
+    }
+
+    ResultadoDistribuido resultado =
+        comando == "coordenar"
+            ? BuscaDistribuida::coordenar(inicial, algoritmo, heuristica, lerEnderecos(opcoes["enderecos"]),
+                                          distribuidas)
+            : BuscaDistribuida::resolver(inicial, algoritmo, heuristica, distribuidas);
+    exibir(inicial, resultado, detalhe);
+    return resultado.erro.empty() ? 0 : 1;
+}
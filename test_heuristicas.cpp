@@ -0,0 +1,111 @@
+// Testes de consistencia entre o objetivo do jogo e as dicas, e entre os
+// custos da busca de fronteira e da Busca Ordenada.
+//
+// Para tabuleiros sorteados, segue a ficha sugerida por MotorDicas::sugerir
+// ate que ReguaPuzzle::verificarVitoria seja verdadeira, com um limite de
+// movimentos para nao entrar em laco.
+#include "ReguaPuzzle.h"
+#include "Dicas.h"
+#include "Gerador.h"
+#include "Solver.h"
+#include <iostream>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+static int falhas = 0;
+
+static void verificar(bool condicao, const std::string& descricao) {
+    if (!condicao) {
+        std::cout << "FALHOU: " << descricao << "\n";
+        ++falhas;
+    }
+}
+
+static bool venceu(ReguaPuzzle& jogo, const std::vector<char>& tabuleiro) {
+    jogo.setTabuleiro(tabuleiro);
+    return jogo.verificarVitoria();
+}
+
+// O objetivo do jogo e o das instrucoes e do Solver: B B B ... _ A A A
+static void testarObjetivo() {
+    for (int n = 1; n <= 4; ++n) {
+        ReguaPuzzle jogo(n);
+        std::vector<char> objetivo(n, 'B');
+        objetivo.push_back('_');
+        objetivo.insert(objetivo.end(), n, 'A');
+        verificar(venceu(jogo, objetivo), "objetivo B..._A... nao vence com n = " + std::to_string(n));
+        verificar(!venceu(jogo, GeradorTabuleiros::invertido(n)),
+                  "tabuleiro invertido vence com n = " + std::to_string(n));
+    }
+}
+
+// Seguir as dicas leva a um tabuleiro vencedor
+static void testarDicasLevamAVitoria() {
+    const int AMOSTRAS = 20;
+    for (int n = 2; n <= 5; ++n) {
+        GeradorTabuleiros gerador(n, 42 + n);
+        ReguaPuzzle jogo(n);
+        // Tabela so em memoria: nada e carregado nem salvo
+        MotorDicas dicas("", 0.01);
+        const int LIMITE = 50 * n * n;
+        for (int a = 0; a < AMOSTRAS; ++a) {
+            std::vector<char> tabuleiro;
+            gerador.sortear(tabuleiro);
+            std::string inicial(tabuleiro.begin(), tabuleiro.end());
+            int movimentos = 0;
+            while (!venceu(jogo, tabuleiro) && movimentos < LIMITE) {
+                MotorDicas::Dica dica = dicas.sugerir(tabuleiro);
+                if (dica.posicao < 0) break;
+                int vazio = (int)(std::find(tabuleiro.begin(), tabuleiro.end(), '_') - tabuleiro.begin());
+                std::swap(tabuleiro[dica.posicao], tabuleiro[vazio]);
+                ++movimentos;
+            }
+            verificar(venceu(jogo, tabuleiro),
+                      "dicas nao levaram " + inicial + " a vitoria em " + std::to_string(movimentos) + " movimentos");
+        }
+    }
+}
+
+// O A* em modo de fronteira chega ao custo otimo (o da Busca Ordenada)
+// tambem com movimentos de custo 0 ou custos diferentes de 1
+static void testarFronteiraComCustos() {
+    const int AMOSTRAS = 10;
+    ModeloCusto modelos[5];
+    modelos[0].deslizar = 0;
+    modelos[1].pulo = 0;
+    modelos[2].pulo = 3;
+    modelos[3].deslizar = 2;
+    modelos[3].pulo = 5;
+    modelos[4].posicao = std::vector<int>({ 0, 1, 2, 0, 1, 2, 0, 1, 2 });
+    for (int n = 2; n <= 4; ++n) {
+        GeradorTabuleiros gerador(n, 7 + n);
+        for (int a = 0; a < AMOSTRAS; ++a) {
+            std::vector<char> tabuleiro;
+            gerador.sortear(tabuleiro);
+            std::string inicial(tabuleiro.begin(), tabuleiro.end());
+            for (int m = 0; m < 5; ++m) {
+                OpcoesSolver opcoes;
+                opcoes.custos = modelos[m];
+                SolverStats ucs = Solver::resolver(tabuleiro, 4, 3, opcoes);
+                opcoes.fronteira = true;
+                SolverStats fronteira = Solver::resolver(tabuleiro, 6, 3, opcoes);
+                verificar(fronteira.profundidade >= 0 && fronteira.custo == ucs.custo,
+                          "fronteira com o modelo " + std::to_string(m) + " em " + inicial + ": custo " +
+                          std::to_string(fronteira.custo) + ", esperado " + std::to_string(ucs.custo));
+            }
+        }
+    }
+}
+
+int main() {
+    testarObjetivo();
+    testarDicasLevamAVitoria();
+    testarFronteiraComCustos();
+    if (falhas > 0) {
+        std::cout << falhas << " verificacao(oes) falharam\n";
+        return 1;
+    }
+    std::cout << "Todos os testes passaram\n";
+    return 0;
+}